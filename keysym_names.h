@@ -0,0 +1,1097 @@
+// keysym_names.h
+//
+// Generated by tools/gen_keysym_names.py from the X11 keysym headers; do not edit.
+// 2427 keysyms, 27780 bytes of names.
+
+#ifndef KEYSYM_NAMES_H
+#define KEYSYM_NAMES_H
+
+#include <stdint.h>
+
+#define KEYSYM_NAME_COUNT   2427
+#define KEYSYM_BUCKET_COUNT 606
+
+typedef struct {
+    uint32_t keysym;
+    uint32_t name;                    // Offset into keysym_name_pool << 8 | length
+} KeysymName;
+
+static const uint32_t keysym_bucket_seeds[KEYSYM_BUCKET_COUNT] = {
+    25, 16, 201, 534, 8, 2, 188, 108,
+    905, 5, 596, 31, 172, 16, 119, 228,
+    156, 453, 306, 653, 32, 14, 1, 470,
+    21, 112, 46, 246, 18, 14, 82, 55,
+    288, 36, 306, 717, 3, 524, 2, 1,
+    1172, 49, 183, 167, 3, 74, 43, 545,
+    54, 46, 6, 449, 165, 5, 61, 15,
+    432, 273, 1, 7, 8, 126, 471, 1,
+    718, 1, 189, 9, 16, 922, 116, 1003,
+    147, 62, 474, 2147, 360, 596, 9, 26,
+    563, 67, 8, 177, 421, 854, 83, 140,
+    18, 144, 48, 510, 174, 324, 0, 481,
+    482, 160, 0, 50, 280, 295, 235, 72,
+    428, 49, 253, 693, 35, 522, 57, 71,
+    371, 398, 19, 138, 1, 223, 25, 26,
+    252, 292, 391, 1, 376, 146, 240, 512,
+    662, 224, 35, 398, 502, 2, 4, 110,
+    1, 394, 421, 126, 14, 20, 473, 532,
+    822, 32, 16, 3, 373, 152, 2185, 3,
+    140, 109, 9, 35, 234, 1, 258, 538,
+    19, 0, 19, 19, 381, 1, 1, 247,
+    1, 346, 562, 115, 751, 49, 559, 0,
+    1034, 397, 549, 366, 160, 696, 431, 548,
+    193, 67, 36, 72, 130, 178, 91, 1104,
+    1252, 18, 2214, 529, 732, 4256, 234, 1,
+    7, 45, 134, 440, 41, 531, 647, 4,
+    551, 641, 166, 2393, 0, 223, 303, 15,
+    955, 509, 257, 18, 873, 290, 568, 1556,
+    0, 685, 64, 3, 17, 1656, 2595, 297,
+    24, 480, 268, 273, 741, 44, 2, 965,
+    7, 267, 422, 951, 71, 15, 0, 8,
+    258, 1203, 375, 399, 91, 217, 266, 842,
+    72, 1182, 51, 2307, 147, 9, 109, 1743,
+    263, 3, 763, 232, 1, 2, 814, 34,
+    0, 652, 73, 8, 672, 2, 980, 964,
+    24, 85, 2322, 285, 71, 1999, 958, 14,
+    36, 1016, 2, 1424, 954, 628, 1204, 1030,
+    541, 110, 1340, 985, 228, 0, 201, 187,
+    668, 185, 198, 1388, 1303, 833, 2273, 24,
+    344, 380, 3847, 348, 0, 1433, 1974, 648,
+    43, 14, 1887, 91, 4142, 1802, 144, 167,
+    3821, 79, 34, 4127, 4297, 3347, 440, 1224,
+    1076, 1502, 33, 2242, 264, 393, 17, 3,
+    3482, 336, 2, 44, 186, 2163, 32, 1341,
+    1384, 159, 214, 252, 215, 9, 772, 559,
+    10, 61, 183, 147, 1962, 1420, 1, 3,
+    593, 447, 167, 3, 231, 226, 4125, 719,
+    3, 32, 134, 269, 21, 1, 384, 44,
+    2433, 208, 4440, 378, 620, 4899, 55, 2137,
+    1, 373, 600, 1, 18, 392, 1, 6,
+    3144, 433, 1, 1512, 294, 4215, 1, 223,
+    2, 267, 13, 2582, 272, 43, 1725, 0,
+    155, 294, 1, 2, 2201, 9, 2731, 579,
+    857, 925, 145, 4553, 85, 94, 120, 551,
+    209, 413, 22, 16, 285, 2346, 1658, 144,
+    202, 684, 272, 645, 2225, 751, 587, 256,
+    592, 44, 3054, 4280, 1106, 363, 5, 421,
+    59, 1051, 805, 1439, 4225, 1027, 23, 21,
+    606, 2492, 6, 6, 828, 4277, 576, 1021,
+    1767, 1277, 2555, 1, 28, 1502, 4747, 414,
+    4497, 1228, 38, 63, 8, 11, 87, 1,
+    322, 121, 1, 4417, 2194, 233, 283, 160,
+    384, 5332, 1187, 6, 1530, 8357, 1148, 351,
+    4149, 659, 2172, 1924, 6488, 249, 45, 61,
+    678, 627, 15, 436, 141, 654, 1, 941,
+    739, 441, 4708, 1118, 1139, 5014, 1591, 2114,
+    274, 1196, 101, 4905, 1200, 335, 253, 141,
+    16, 450, 411, 910, 1, 2, 10, 46,
+    4909, 78, 234, 1223, 327, 67, 134, 1318,
+    25, 95, 266, 3166, 1, 346, 4064, 941,
+    958, 1669, 3444, 57, 3585, 2966, 840, 131,
+    3913, 19, 307, 2, 4576, 1105, 136, 4472,
+    4202, 1, 5740, 0, 25, 343, 2233, 54,
+    2150, 0, 13563, 1522, 534, 3, 523, 0,
+    2, 328, 191, 166, 1748, 222, 4254, 2341,
+    82, 64, 442, 2955, 705, 597,
+};
+
+static const KeysymName keysym_names[KEYSYM_NAME_COUNT] = {
+    {0x00000040, 0x2}, {0x010028db, 0x213}, {0x01001e37, 0x1509}, {0x010028c7, 0x1e12},
+    {0x0100283f, 0x3013}, {0x000005e0, 0x430e}, {0x00000ec9, 0x510a}, {0x0000ffdc, 0x5b03},
+    {0x1008ff68, 0x5e07}, {0x000000db, 0x650b}, {0x01000581, 0x700c}, {0x000009f0, 0x7c0e},
+    {0x000004ce, 0x8a07}, {0x1008ff9e, 0x9110}, {0x000006df, 0xa111}, {0x00000da9, 0xb20d},
+    {0x000003d9, 0xbf07}, {0x0000006c, 0xc601}, {0x01001ee9, 0xc70a}, {0x1008129f, 0xd10b},
+    {0x0100057d, 0xdc0b}, {0x000001a9, 0xe706}, {0x01002842, 0xed0f}, {0x010028fc, 0xfc13},
+    {0x00000ebe, 0x10f0c}, {0x10081251, 0x11b11}, {0x000006ce, 0x12c0b}, {0x000000b9, 0x1370b},
+    {0x1008fe23, 0x1420e}, {0x100000aa, 0x15012}, {0x10081219, 0x1620e}, {0x000006b0, 0x1700a},
+    {0x100000be, 0x17a09}, {0x1004ff58, 0x1830c}, {0x01000300, 0x18f0f}, {0x1008ff4d, 0x19e0b},
+    {0x0000ff93, 0x1a905}, {0x010028b0, 0x1ae10}, {0x0000003a, 0x1be05}, {0x01002870, 0x1c310},
+    {0x00000abd, 0x1d30c}, {0x000007f1, 0x1df09}, {0x01001ecb, 0x1e809}, {0x0000ff30, 0x1f10b},
+    {0x0000fe84, 0x1fc06}, {0x1008129e, 0x2020b}, {0x010010e1, 0x20d0c}, {0x1008ff6d, 0x21909},
+    {0x0000fe0b, 0x22213}, {0x010006be, 0x23516}, {0x0000fe0f, 0x24b13}, {0x0100284d, 0x25e11},
+    {0x01000db8, 0x26f07}, {0x010006a9, 0x2760c}, {0x000005c4, 0x28211}, {0x1004ff69, 0x29309},
+    {0x000007ce, 0x29c08}, {0x000006b1, 0x2a40b}, {0x0100289d, 0x2af12}, {0x00000dc4, 0x2c107},
+    {0x0000ff98, 0x2c808}, {0x0000fd07, 0x2d00f}, {0x0000ffdb, 0x2df03}, {0x010004d8, 0x2e20e},
+    {0x010020a3, 0x2f00a}, {0x0000fefc, 0x2fa13}, {0x000006fd, 0x30d0e}, {0x00000eba, 0x31b0c},
+    {0x010028b7, 0x32713}, {0x10081261, 0x33a16}, {0x01001eec, 0x35009}, {0x0100221b, 0x35908},
+    {0x1005ff7b, 0x36117}, {0x000007c1, 0x3780b}, {0x01002205, 0x38308}, {0x01001ea0, 0x38b09},
+    {0x01002895, 0x39411}, {0x1008ff33, 0x3a50e}, {0x01001eb0, 0x3b30b}, {0x1000fe2c, 0x3be0f},
+    {0x00000eb4, 0x3cd10}, {0x01002085, 0x3dd0d}, {0x010010ed, 0x3ea0d}, {0x01002088, 0x3f70e},
+    {0x0000ff68, 0x40504}, {0x1008ff7e, 0x4090b}, {0x1008fe09, 0x4140f}, {0x000001a6, 0x42306},
+    {0x0000ff08, 0x42909}, {0x01002838, 0x43210}, {0x000005f0, 0x4420c}, {0x0000fe81, 0x44e06},
+    {0x000006c7, 0x4540c}, {0x000009e2, 0x46002}, {0x010028b2, 0x46211}, {0x000009eb, 0x4730d},
+    {0x00000cf5, 0x48010}, {0x010010e6, 0x4900d}, {0x1004ff65, 0x49d07}, {0x000007d5, 0x4a40d},
+    {0x1008ff92, 0x4b109}, {0x00000ecf, 0x4ba09}, {0x1005ff03, 0x4c30b}, {0x00000da4, 0x4ce0d},
+    {0x010028de, 0x4db13}, {0x00000cf6, 0x4ee0b}, {0x000003d3, 0x4f908}, {0x0000004a, 0x50101},
+    {0x0100288f, 0x50212}, {0x010004a3, 0x51415}, {0x0100287c, 0x52912}, {0x00000ed7, 0x53b0e},
+    {0x01002889, 0x54910}, {0x010006d4, 0x5590f}, {0x000008a8, 0x56810}, {0x00000de4, 0x57813},
+    {0x00000ae9, 0x58b13}, {0x000000fe, 0x59e05}, {0x01001ef4, 0x5a309}, {0x000006ca, 0x5ac0f},
+    {0x000000f4, 0x5bb0b}, {0x10081205, 0x5c60c}, {0x0100286a, 0x5d211}, {0x000005c5, 0x5e315},
+    {0x00000069, 0x5f801}, {0x01001ed0, 0x5f910}, {0x100812b5, 0x60910}, {0x1005ff75, 0x61906},
+    {0x0100018f, 0x61f05}, {0x01000dac, 0x62409}, {0x0000fe6b, 0x62d0f}, {0x1008ff62, 0x63c0a},
+    {0x0000ff99, 0x64607}, {0x1000ff72, 0x64d0c}, {0x00000ef3, 0x65918}, {0x00000048, 0x67101},
+    {0x0000ff36, 0x6720d}, {0x01002840, 0x67f0e}, {0x000006f0, 0x68d0b}, {0x0000ff9f, 0x69809},
+    {0x0100049a, 0x6a115}, {0x0100057b, 0x6b60b}, {0x0000fff1, 0x6c10d}, {0x000005cf, 0x6ce0a},
+    {0x000006dc, 0x6d80a}, {0x0000ffaf, 0x6e209}, {0x000007c5, 0x6eb0d}, {0x1008ff7c, 0x6f809},
+    {0x10081270, 0x70110}, {0x000007cf, 0x7110d}, {0x01001ef5, 0x71e09}, {0x000006d2, 0x7270b},
+    {0x10081206, 0x7320c}, {0x000000cc, 0x73e06}, {0x000000b0, 0x74406}, {0x01000d96, 0x74a07},
+    {0x1008126e, 0x7510d}, {0x0100019f, 0x75e07}, {0x000000c2, 0x7650b}, {0x0000ff54, 0x77004},
+    {0x1008ff3a, 0x7740c}, {0x1008ff23, 0x7800c}, {0x100810f4, 0x78c12}, {0x00000ef9, 0x79e1a},
+    {0x000000a9, 0x7b809}, {0x000006ab, 0x7c10c}, {0x000004b2, 0x7cd06}, {0x00000da7, 0x7d30b},
+    {0x01001e41, 0x7de09}, {0x010004bb, 0x7e70d}, {0x000006d9, 0x7f40d}, {0x01000da7, 0x80108},
+    {0x000008c0, 0x80909}, {0x01002843, 0x81210}, {0x100812a1, 0x8220b}, {0x00000ddf, 0x82d09},
+    {0x000006be, 0x83613}, {0x010028f0, 0x84911}, {0x0000fd10, 0x85a0e}, {0x000008a3, 0x8680e},
+    {0x0000fe55, 0x8760a}, {0x00000aec, 0x88004}, {0x1008ff3c, 0x8840b}, {0x010028b5, 0x88f12},
+    {0x0100289f, 0x8a113}, {0x1000fe7e, 0x8b406}, {0x000000ff, 0x8ba0a}, {0x010010f6, 0x8c40b},
+    {0x00000db5, 0x8cf0a}, {0x00000044, 0x8d901}, {0x0000fe26, 0x8da17}, {0x1004ff43, 0x8f10c},
+    {0x01001eab, 0x8fd10}, {0x00000ea8, 0x90d12}, {0x00000ba8, 0x91f09}, {0x000006a5, 0x9280d},
+    {0x1005ff72, 0x93507}, {0x0000ff2b, 0x93c07}, {0x01001ee3, 0x9430d}, {0x0000fee6, 0x95010},
+    {0x00000ce9, 0x9600a}, {0x0100055d, 0x96a18}, {0x00000eab, 0x98211}, {0x1008ff89, 0x99308},
+    {0x010028b8, 0x99b11}, {0x10081217, 0x9ac0c}, {0x000006f2, 0x9b80b}, {0x1008ff51, 0x9c314},
+    {0x1008ff3b, 0x9d714}, {0x0100280f, 0x9eb11}, {0x000004cf, 0x9fc07}, {0x000006fe, 0xa030c},
+    {0x01000698, 0xa0f0a}, {0x0000005a, 0xa1901}, {0x1008ff74, 0xa1a11}, {0x010028cc, 0xa2b11},
+    {0x000003ef, 0xa3c07}, {0x01000665, 0xa4308}, {0x00000cef, 0xa4b0f}, {0x1008ff10, 0xa5a0b},
+    {0x000005d1, 0xa6509}, {0x01001ed7, 0xa6e10}, {0x00000ed6, 0xa7e13}, {0x0000fe0e, 0xa910e},
+    {0x01000536, 0xa9f0b}, {0x000000f8, 0xaaa06}, {0x010006cc, 0xab009}, {0x0000005f, 0xab90a},
+    {0x00000dc6, 0xac307}, {0x000000e1, 0xaca06}, {0x0000ff7e, 0xad00b}, {0x10081296, 0xadb0a},
+    {0x000004dd, 0xae506}, {0x01002801, 0xaeb0e}, {0x000009df, 0xaf905}, {0x000006e6, 0xafe0b},
+    {0x10081269, 0xb090c}, {0x00000dae, 0xb150c}, {0x0100287e, 0xb2113}, {0x01000585, 0xb340a},
+    {0x01002879, 0xb3e12}, {0x0000ffdf, 0xb5003}, {0x010010da, 0xb530c}, {0x1008fe01, 0xb5f0f},
+    {0x01001ea9, 0xb6e0f}, {0x0100284e, 0xb7d11}, {0x100000ac, 0xb8e11}, {0x00000df6, 0xb9f0b},
+    {0x0000fff7, 0xbaa0d}, {0x000000f3, 0xbb706}, {0x0000fe82, 0xbbd06}, {0x00000ace, 0xbc30c},
+    {0x0000ff34, 0xbcf0c}, {0x1008ff38, 0xbdb0b}, {0x0000fee0, 0xbe60c}, {0x00000042, 0xbf201},
+    {0x1008ff3d, 0xbf30d}, {0x01001ec8, 0xc0005}, {0x10081299, 0xc050b}, {0x0100284f, 0xc1012},
+    {0x010010e9, 0xc220d}, {0x0000fd01, 0xc2f0e}, {0x00000ecd, 0xc3d0a}, {0x1008ff02, 0xc4713},
+    {0x1008129a, 0xc5a0b}, {0x1008ff7d, 0xc650f}, {0x000006a3, 0xc740b}, {0x010020a0, 0xc7f07},
+    {0x00000eaf, 0xc8612}, {0x1008120f, 0xc980c}, {0x01000570, 0xca40b}, {0x01000552, 0xcaf0d},
+    {0x1008ff5d, 0xcbc0c}, {0x01000580, 0xcc80b}, {0x01001e60, 0xcd309}, {0x010010de, 0xcdc0c},
+    {0x0000005b, 0xce80b}, {0x00000ea5, 0xcf311}, {0x1008ffa5, 0xd040a}, {0x10081293, 0xd0e0a},
+    {0x100812bb, 0xd180f}, {0x0000fd0e, 0xd2709}, {0x0100053d, 0xd300c}, {0x00000eee, 0xd3c0e},
+    {0x010028eb, 0xd4a13}, {0x1000ff48, 0xd5d0b}, {0x010028df, 0xd6814}, {0x000006e2, 0xd7c0b},
+    {0x000001f2, 0xd8706}, {0x100812a0, 0xd8d0b}, {0x0000fef9, 0xd9812}, {0x0000ffe3, 0xdaa09},
+    {0x01001e82, 0xdb306}, {0x00000aa1, 0xdb907}, {0x01002070, 0xdc00c}, {0x01000ddc, 0xdcc07},
+    {0x000001e8, 0xdd306}, {0x01000543, 0xdd90d}, {0x0100280b, 0xde610}, {0x1008ff97, 0xdf610},
+    {0x000000a5, 0xe0603}, {0x00000dd7, 0xe090c}, {0x000000d1, 0xe1506}, {0x01000582, 0xe1b0d},
+    {0x000009f7, 0xe2804}, {0x0100281c, 0xe2c10}, {0x010010d3, 0xe3c0c}, {0x01000d9a, 0xe4807},
+    {0x01001ea6, 0xe4f10}, {0x000000af, 0xe5f06}, {0x000001b6, 0xe6506}, {0x010020aa, 0xe6b0d},
+    {0x000006a2, 0xe780d}, {0x000007f0, 0xe8508}, {0x0000fe27, 0xe8d13}, {0x1004ff07, 0xea00a},
+    {0x0000fe5a, 0xeaa0a}, {0x000004d8, 0xeb407}, {0x000007e3, 0xebb0b}, {0x0000ff33, 0xec60a},
+    {0x000001b1, 0xed007}, {0x01002813, 0xed710}, {0x01002818, 0xee70f}, {0x00000063, 0xef601},
+    {0x0000ff27, 0xef711}, {0x01002897, 0xf0812}, {0x01001ed9, 0xf1a13}, {0x01002857, 0xf2d12},
+    {0x01000545, 0xf3f0b}, {0x0100282f, 0xf4a12}, {0x010004b9, 0xf5c17}, {0x0000fff9, 0xf730d},
+    {0x0000ffd6, 0xf8003}, {0x000003cf, 0xf8307}, {0x010028f1, 0xf8a12}, {0x000007e1, 0xf9c0b},
+    {0x1008ff6e, 0xfa709}, {0x01000da6, 0xfb008}, {0x0000fd09, 0xfb809}, {0x01000d8a, 0xfc107},
+    {0x0000fe0c, 0xfc80f}, {0x00000ce6, 0xfd70b}, {0x010006ba, 0xfe212}, {0x0000fd1a, 0xff40f},
+    {0x01001eb5, 0x10030b}, {0x01002867, 0x100e12}, {0x0000ff3e, 0x102011}, {0x000005e9, 0x103112},
+    {0x010004b2, 0x104315}, {0x000000fc, 0x10580a}, {0x000004b1, 0x106206}, {0x000008a5, 0x10680b},
+    {0x01002865, 0x107311}, {0x01001ec7, 0x108413}, {0x100811a8, 0x109712}, {0x0000ffc0, 0x10a902},
+    {0x0000ff38, 0x10ab0d}, {0x01001eba, 0x10b805}, {0x0000fe60, 0x10bd0d}, {0x1008fe20, 0x10ca0a},
+    {0x0000005d, 0x10d40c}, {0x000007f9, 0x10e00b}, {0x1008ff53, 0x10eb06}, {0x01001ed4, 0x10f10f},
+    {0x0000ff25, 0x110008}, {0x010028bc, 0x110812}, {0x01001ece, 0x111a05}, {0x1008ff30, 0x111f0d},
+    {0x000007b6, 0x112c18}, {0x000008cd, 0x114408}, {0x100812ac, 0x114c0b}, {0x000004d0, 0x115707},
+    {0x00000bdc, 0x115e08}, {0x010004e2, 0x116611}, {0x00000ed8, 0x117713}, {0x1000ff77, 0x118a0a},
+    {0x1005ff01, 0x11940c}, {0x00000da8, 0x11a00c}, {0x01000dc3, 0x11ac07}, {0x0000fe88, 0x11b306},
+    {0x0000ff6b, 0x11b905}, {0x0000fea5, 0x11be03}, {0x0000ff28, 0x11c107}, {0x000004b4, 0x11c806},
+    {0x010010e8, 0x11ce0d}, {0x000006a6, 0x11db0b}, {0x000008da, 0x11e60a}, {0x000004d7, 0x11f007},
+    {0x1008ffa4, 0x11f709}, {0x010028f4, 0x120012}, {0x00000de1, 0x12120b}, {0x00000da5, 0x121d0c},
+    {0x000001a3, 0x122907}, {0x010028da, 0x123012}, {0x010028bd, 0x124213}, {0x00000ae2, 0x12550e},
+    {0x000008c8, 0x12630b}, {0x01002802, 0x126e0e}, {0x0000feeb, 0x127c0f}, {0x100811aa, 0x128b0c},
+    {0x0000fe34, 0x129709}, {0x000001d0, 0x12a007}, {0x00000ded, 0x12a70d}, {0x01001eb2, 0x12b40a},
+    {0x000004b9, 0x12be07}, {0x00000ee3, 0x12c50e}, {0x1008fe07, 0x12d30f}, {0x1004ff0b, 0x12e208},
+    {0x000003a3, 0x12ea08}, {0x000001bf, 0x12f209}, {0x00000dec, 0x12fb10}, {0x000003aa, 0x130b07},
+    {0x1004ff40, 0x13120b}, {0x000008bd, 0x131d08}, {0x000006c8, 0x13250b}, {0x00000053, 0x133001},
+    {0x000000fa, 0x133106}, {0x0000fe69, 0x133714}, {0x0000fe8b, 0x134b12}, {0x000005d5, 0x135d0a},
+    {0x000007ec, 0x136708}, {0x0000fe2e, 0x136f12}, {0x000009f4, 0x138105}, {0x01002805, 0x13860f},
+    {0x0000fee1, 0x13950d}, {0x0100283b, 0x13a212}, {0x000006f4, 0x13b40b}, {0x01001e1f, 0x13bf09},
+    {0x1008ffa7, 0x13c80b}, {0x0000ffee, 0x13d307}, {0x00000ec7, 0x13da08}, {0x100000f6, 0x13e20b},
+    {0x00000ab8, 0x13ed06}, {0x1004ff31, 0x13f30a}, {0x01001ea2, 0x13fd05}, {0x010020a5, 0x140208},
+    {0x0000fe6c, 0x140a13}, {0x000001ae, 0x141d06}, {0x0000fed2, 0x142313}, {0x000002bc, 0x14360b},
+    {0x0100054d, 0x14410b}, {0x100811af, 0x144c11}, {0x0100287b, 0x145d13}, {0x01002076, 0x14700b},
+    {0x000008aa, 0x147b11}, {0x0100066a, 0x148c0e}, {0x01002087, 0x149a0e}, {0x10081218, 0x14a80e},
+    {0x01000d8b, 0x14b606}, {0x00000dbf, 0x14bc0a}, {0x000007a5, 0x14c612}, {0x0000fd14, 0x14d809},
+    {0x010028d1, 0x14e111}, {0x01002868, 0x14f210}, {0x00000ebb, 0x15020d}, {0x000001bc, 0x150f06},
+    {0x000000d5, 0x151506}, {0x100000a8, 0x151b0c}, {0x01000d8f, 0x152707}, {0x00000ea1, 0x152e0d},
+    {0x0100053e, 0x153b0c}, {0x1000ff6c, 0x154707}, {0x0000007b, 0x154e09}, {0x100811ac, 0x15570d},
+    {0x0100288a, 0x156410}, {0x01000572, 0x15740d}, {0x0100284b, 0x158111}, {0x000000c1, 0x159206},
+    {0x01000d92, 0x159807}, {0x000009f3, 0x159f0e}, {0x0000004e, 0x15ad01}, {0x0000005c, 0x15ae09},
+    {0x000000ec, 0x15b706}, {0x010001d1, 0x15bd06}, {0x0000006f, 0x15c301}, {0x01000664, 0x15c408},
+    {0x1008ff3e, 0x15cc0f}, {0x01000d87, 0x15db07}, {0x0000fffa, 0x15e20e}, {0x01002875, 0x15f012},
+    {0x00000039, 0x160201}, {0x000000b5, 0x160302}, {0x000005e4, 0x16050a}, {0x00000ef0, 0x160f18},
+    {0x10081295, 0x16270a}, {0x1005ff11, 0x163106}, {0x000003a5, 0x163706}, {0x010028c2, 0x163d10},
+    {0x100000a9, 0x164d0c}, {0x00000ec3, 0x165909}, {0x000007b7, 0x166213}, {0x1000ff76, 0x16750a},
+    {0x01000df4, 0x167f0f}, {0x000004b7, 0x168e07}, {0x00000ecc, 0x169508}, {0x00000ea7, 0x169d0d},
+    {0x000004a4, 0x16aa0a}, {0x01000301, 0x16b40f}, {0x10081230, 0x16c30d}, {0x000001d8, 0x16d006},
+    {0x01001e81, 0x16d606}, {0x0000fd13, 0x16dc0a}, {0x00000eff, 0x16e60a}, {0x00000ad7, 0x16f007},
+    {0x1008ff93, 0x16f70b}, {0x000013be, 0x17020a}, {0x00000ad2, 0x170c13}, {0x00000bc2, 0x171f08},
+    {0x1008ff9f, 0x172708}, {0x00000074, 0x172f01}, {0x1005ff76, 0x17300e}, {0x0000ff3a, 0x173e0f},
+    {0x100811d1, 0x174d0a}, {0x0000fff6, 0x17570d}, {0x000006fc, 0x17640a}, {0x0000fe91, 0x176e16},
+    {0x00000bc4, 0x178409}, {0x01001ecf, 0x178d05}, {0x01002850, 0x17920f}, {0x010028e5, 0x17a112},
+    {0x010028a7, 0x17b312}, {0x000002e5, 0x17c509}, {0x00000dd3, 0x17ce0b}, {0x0000006b, 0x17d901},
+    {0x010028f5, 0x17da13}, {0x000000ad, 0x17ed06}, {0x0000fe89, 0x17f306}, {0x00000068, 0x17f901},
+    {0x000004df, 0x17fa0f}, {0x000006ec, 0x18090b}, {0x00000af8, 0x18140c}, {0x1008ff47, 0x18200b},
+    {0x0000fe5d, 0x182b09}, {0x0000fd18, 0x18340b}, {0x0100012d, 0x183f06}, {0x000005d3, 0x18450b},
+    {0x000000cd, 0x185006}, {0x01000544, 0x18560c}, {0x01000da8, 0x186209}, {0x000006e9, 0x186b0a},
+    {0x0000fe83, 0x187506}, {0x0100282a, 0x187b10}, {0x010028f2, 0x188b12}, {0x010020a8, 0x189d09},
+    {0x010010f3, 0x18a60b}, {0x1008ff7f, 0x18b10c}, {0x01000dcf, 0x18bd08}, {0x010028f7, 0x18c514},
+    {0x1004ff59, 0x18d90a}, {0x0000ffd1, 0x18e303}, {0x000004a6, 0x18e607}, {0x01002869, 0x18ed11},
+    {0x00000dc9, 0x18fe0b}, {0x010006af, 0x19090a}, {0x01000176, 0x19130b}, {0x0000fe52, 0x191e0f},
+    {0x01001e8b, 0x192d09}, {0x00000eac, 0x193611}, {0x010010d0, 0x19470b}, {0x000006c0, 0x19520b},
+    {0x1008ff4b, 0x195d0b}, {0x0000fe71, 0x196817}, {0x01001ed2, 0x197f10}, {0x0000fef0, 0x198f11},
+    {0x0100282b, 0x19a011}, {0x000000d4, 0x19b10b}, {0x01001ee0, 0x19bc0a}, {0x00000df3, 0x19c60b},
+    {0x0000ffe8, 0x19d106}, {0x00000df0, 0x19d70b}, {0x000007e7, 0x19e209}, {0x01002887, 0x19eb11},
+    {0x0000ffcf, 0x19fc03}, {0x00000ce4, 0x19ff09}, {0x1008ff7b, 0x1a0808}, {0x0000ff95, 0x1a1007},
+    {0x00000047, 0x1a1701}, {0x1008ff1e, 0x1a1808}, {0x01000686, 0x1a200c}, {0x000008c2, 0x1a2c08},
+    {0x000000e4, 0x1a340a}, {0x0000fef1, 0x1a3e11}, {0x01000569, 0x1a4f0b}, {0x010010d8, 0x1a5a0b},
+    {0x0000fe59, 0x1a6510}, {0x01002807, 0x1a7510}, {0x1008121e, 0x1a8510}, {0x000002ab, 0x1a9506},
+    {0x000008a4, 0x1a9b0b}, {0x00000adc, 0x1aa613}, {0x00000dc0, 0x1ab90f}, {0x01001ebe, 0x1ac810},
+    {0x000006f6, 0x1ad80c}, {0x000005bf, 0x1ae414}, {0x10081271, 0x1af80e}, {0x000004d5, 0x1b0607},
+    {0x00000052, 0x1b0d01}, {0x0100053a, 0x1b0e0c}, {0x000007a9, 0x1b1a15}, {0x000002c5, 0x1b2f09},
+    {0x01000532, 0x1b380c}, {0x00000ec1, 0x1b4409}, {0x01001ec0, 0x1b4d10}, {0x000000f2, 0x1b5d06},
+    {0x00000aed, 0x1b6307}, {0x0000ff52, 0x1b6a02}, {0x0000ff63, 0x1b6c06}, {0x000006e0, 0x1b720b},
+    {0x000004db, 0x1b7d07}, {0x00000ebc, 0x1b840c}, {0x000006ad, 0x1b9019}, {0x0000fd04, 0x1ba90a},
+    {0x000007cb, 0x1bb30b}, {0x0000fe8a, 0x1bbe10}, {0x0000fea3, 0x1bce03}, {0x00000ced, 0x1bd10f},
+    {0x000007d9, 0x1be00b}, {0x00000dd5, 0x1beb0b}, {0x00000ad1, 0x1bf614}, {0x0000ff21, 0x1c0a05},
+    {0x000001a2, 0x1c0f05}, {0x1008ffb3, 0x1c140c}, {0x1004ff41, 0x1c2009}, {0x0000fe33, 0x1c2911},
+    {0x0000ffd8, 0x1c3a03}, {0x000003fd, 0x1c3d06}, {0x0100285e, 0x1c4312}, {0x0000ff0a, 0x1c5508},
+    {0x010028cb, 0x1c5d12}, {0x010004ae, 0x1c6f13}, {0x100811a4, 0x1c820d}, {0x010028c1, 0x1c8f10},
+    {0x010028e6, 0x1c9f12}, {0x10081166, 0x1cb108}, {0x01002871, 0x1cb911}, {0x010028b6, 0x1cca12},
+    {0x000000ea, 0x1cdc0b}, {0x010010ee, 0x1ce70c}, {0x0000fe65, 0x1cf317}, {0x00000030, 0x1d0a01},
+    {0x0000fe77, 0x1d0b16}, {0x01002883, 0x1d2110}, {0x000001be, 0x1d3106}, {0x000004bb, 0x1d3707},
+    {0x1004ff67, 0x1d3e07}, {0x010010ea, 0x1d450c}, {0x100811a0, 0x1d510e}, {0x0000fee5, 0x1d5f0f},
+    {0x000002a9, 0x1d6e09}, {0x000000a1, 0x1d770a}, {0x1008ff2f, 0x1d8109}, {0x1008fe02, 0x1d8a0f},
+    {0x000006f3, 0x1d990b}, {0x100812a7, 0x1da40b}, {0x1008fe0b, 0x1daf10}, {0x000005c2, 0x1dbf12},
+    {0x01001e03, 0x1dd109}, {0x00000cee, 0x1dda0a}, {0x01000567, 0x1de40a}, {0x000006bd, 0x1dee19},
+    {0x1008ff2d, 0x1e070f}, {0x000008ac, 0x1e160d}, {0x0000fe30, 0x1e2318}, {0x000000ac, 0x1e3b07},
+    {0x00000dbc, 0x1e420d}, {0x100812b3, 0x1e4f10}, {0x1008ff82, 0x1e5f0a}, {0x00000032, 0x1e6901},
+    {0x000008cf, 0x1e6a09}, {0x00000dce, 0x1e730d}, {0x000000bb, 0x1e800e}, {0x01001e40, 0x1e8e09},
+    {0x01000df3, 0x1e9709}, {0x0000ffcb, 0x1ea003}, {0x0000fe5c, 0x1ea30b}, {0x0000fd0c, 0x1eae08},
+    {0x00000070, 0x1eb601}, {0x000005c8, 0x1eb70a}, {0x000007f6, 0x1ec109}, {0x00000ea2, 0x1eca12},
+    {0x0000ff24, 0x1edc06}, {0x0000fef5, 0x1ee20d}, {0x01001ee7, 0x1eef05}, {0x000000a0, 0x1ef40c},
+    {0x000008ad, 0x1f000e}, {0x01002853, 0x1f0e11}, {0x0000ffeb, 0x1f1f07}, {0x00000cf0, 0x1f260a},
+    {0x10081200, 0x1f300c}, {0x01001eaf, 0x1f3c0b}, {0x000000dc, 0x1f470a}, {0x01001eb3, 0x1f510a},
+    {0x000000c6, 0x1f5b02}, {0x1005ff79, 0x1f5d13}, {0x01000541, 0x1f700c}, {0x01002890, 0x1f7c0f},
+    {0x00000046, 0x1f8b01}, {0x010028ad, 0x1f8c12}, {0x000000dd, 0x1f9e06}, {0x000004b5, 0x1fa406},
+    {0x01000668, 0x1faa08}, {0x01002074, 0x1fb20c}, {0x00000065, 0x1fbe01}, {0x01000dad, 0x1fbf08},
+    {0x01000496, 0x1fc716}, {0x01002844, 0x1fdd0f}, {0x000000c3, 0x1fec06}, {0x000008be, 0x1ff210},
+    {0x010028ea, 0x200212}, {0x01000573, 0x20140d}, {0x1004ff04, 0x202108}, {0x1008121b, 0x20290f},
+    {0x010028e4, 0x203811}, {0x01000493, 0x204910}, {0x00000ea9, 0x20590c}, {0x000001d1, 0x206506},
+    {0x1008fe0c, 0x206b10}, {0x000006a8, 0x207b0b}, {0x000006ee, 0x20860b}, {0x000007cc, 0x209108},
+    {0x0100280d, 0x209910}, {0x1008ff18, 0x20a90c}, {0x0000ff89, 0x20b506}, {0x00000db0, 0x20bb0c},
+    {0x00000ac3, 0x20c709}, {0x0000ff60, 0x20d006}, {0x010028d4, 0x20d611}, {0x00000adf, 0x20e70c},
+    {0x010010dd, 0x20f30b}, {0x01001eb7, 0x20fe0e}, {0x000003ac, 0x210c06}, {0x00000033, 0x211201},
+    {0x0000fea2, 0x211302}, {0x1005ff7c, 0x211517}, {0x00000031, 0x212c01}, {0x01000667, 0x212d08},
+    {0x0000fe2b, 0x213518}, {0x0100288b, 0x214d11}, {0x000000ed, 0x215e06}, {0x1004ff72, 0x21640e},
+    {0x10081216, 0x217211}, {0x1004ff45, 0x21830a}, {0x00000dd6, 0x218d0b}, {0x00000bc6, 0x219808},
+    {0x00000aa5, 0x21a00a}, {0x0000fe92, 0x21aa16}, {0x0000ffb0, 0x21c004}, {0x00000eca, 0x21c409},
+    {0x1008ff79, 0x21cd0e}, {0x01001ebb, 0x21db05}, {0x010028dc, 0x21e012}, {0x00000dcf, 0x21f20e},
+    {0x01001ebc, 0x220006}, {0x0000ff26, 0x220608}, {0x00000dc5, 0x220e0b}, {0x1008ff37, 0x22190b},
+    {0x01001eb8, 0x222409}, {0x000004cd, 0x222d07}, {0x000009e8, 0x223402}, {0x00000ab4, 0x22360b},
+    {0x1005ff77, 0x224113}, {0x000004a3, 0x225413}, {0x01001ec9, 0x226705}, {0x000013bc, 0x226c02},
+    {0x000008a9, 0x226e11}, {0x01000df2, 0x227f09}, {0x0000fd1e, 0x22880a}, {0x10081273, 0x229207},
+    {0x0000fe32, 0x22990d}, {0x10081211, 0x22a60d}, {0x000007d7, 0x22b309}, {0x01002873, 0x22bc12},
+    {0x01001ebf, 0x22ce10}, {0x0000fe66, 0x22de10}, {0x01001eca, 0x22ee09}, {0x00000025, 0x22f707},
+    {0x1000ff6e, 0x22fe06}, {0x000005c1, 0x23040c}, {0x000006c5, 0x23100b}, {0x000007bb, 0x231b11},
+    {0x00000026, 0x232c09}, {0x000007af, 0x23350e}, {0x01001ebd, 0x234306}, {0x0000ffb7, 0x234904},
+    {0x01001ecd, 0x234d09}, {0x0000fd0b, 0x235608}, {0x1008ff12, 0x235e0d}, {0x00000dbb, 0x236b0a},
+    {0x010028ca, 0x237511}, {0x000005e8, 0x23860a}, {0x00000036, 0x239001}, {0x01002263, 0x239108},
+    {0x1008ff63, 0x23990b}, {0x01002834, 0x23a410}, {0x01000653, 0x23b412}, {0x000005d2, 0x23c60b},
+    {0x10081202, 0x23d10c}, {0x1008ff2b, 0x23dd0a}, {0x0000002e, 0x23e706}, {0x000004d6, 0x23ed07},
+    {0x000005ce, 0x23f40b}, {0x1008fe0a, 0x23ff10}, {0x0000fe6a, 0x240f0f}, {0x010004af, 0x241e13},
+    {0x0100012c, 0x243106}, {0x100811b6, 0x24370f}, {0x1008ff2a, 0x24460c}, {0x0000ffbe, 0x245202},
+    {0x00000af6, 0x24540b}, {0x00000060, 0x245f05}, {0x0000ffb2, 0x246404}, {0x00000ec5, 0x24680a},
+    {0x0000fef3, 0x247211}, {0x1008ff31, 0x24830e}, {0x00000ce1, 0x24910a}, {0x000000fd, 0x249b06},
+    {0x0000fe09, 0x24a113}, {0x000008b6, 0x24b411}, {0x000000ef, 0x24c50a}, {0x100812a3, 0x24cf0b},
+    {0x00000bcf, 0x24da06}, {0x0000fff2, 0x24e00d}, {0x0000fee8, 0x24ed13}, {0x01002821, 0x25000f},
+    {0x01000679, 0x250f0b}, {0x0100054f, 0x251a0d}, {0x010028e7, 0x252713}, {0x010010df, 0x253a0d},
+    {0x1004ff5c, 0x25470b}, {0x10081246, 0x255210}, {0x0000fe56, 0x25620d}, {0x00000043, 0x256f01},
+    {0x0000003e, 0x257007}, {0x0100222d, 0x257709}, {0x0000ff22, 0x258008}, {0x000002a6, 0x25880b},
+    {0x000004c6, 0x259307}, {0x000006bc, 0x259a0d}, {0x00000aea, 0x25a70b}, {0x1004ff71, 0x25b20c},
+    {0x0000ffb4, 0x25be04}, {0x0000fe86, 0x25c206}, {0x000000a2, 0x25c804}, {0x10081249, 0x25cc0f},
+    {0x00000062, 0x25db01}, {0x00000ae3, 0x25dc0f}, {0x01001ec1, 0x25eb10}, {0x000006e3, 0x25fb0c},
+    {0x0100282e, 0x260711}, {0x0000fe13, 0x26180f}, {0x00000eb2, 0x26270c}, {0x10081291, 0x26330a},
+    {0x010004a2, 0x263d15}, {0x000000cf, 0x26520a}, {0x00000dbd, 0x265c09}, {0x01000d8d, 0x266507},
+    {0x000007a8, 0x266c13}, {0x010028ef, 0x267f14}, {0x0100058a, 0x26930f}, {0x000004aa, 0x26a206},
+    {0x0000ffc4, 0x26a802}, {0x00000aca, 0x26aa0d}, {0x000000ca, 0x26b70b}, {0x000006b8, 0x26c20b},
+    {0x01000daf, 0x26cd08}, {0x01001eed, 0x26d509}, {0x000004dc, 0x26de07}, {0x01001ef0, 0x26e50d},
+    {0x0000fee2, 0x26f20a}, {0x0000fed4, 0x26fc13}, {0x010028e9, 0x270f12}, {0x01000553, 0x27210d},
+    {0x0000fd0f, 0x272e10}, {0x000003de, 0x273e07}, {0x1008126b, 0x274510}, {0x0000fe7a, 0x275512},
+    {0x000005ef, 0x27670c}, {0x000005ea, 0x27730a}, {0x010010d2, 0x277d0c}, {0x000001ea, 0x278907},
+    {0x000009e1, 0x27900c}, {0x00000de0, 0x279c0a}, {0x00000ef7, 0x27a60d}, {0x00000edc, 0x27b314},
+    {0x00000ab3, 0x27c709}, {0x0000fe22, 0x27d012}, {0x00000028, 0x27e209}, {0x0000fe5b, 0x27eb0c},
+    {0x00000eb0, 0x27f711}, {0x01000dbd, 0x280807}, {0x000004c0, 0x280f07}, {0x00000ada, 0x281608},
+    {0x0000ff97, 0x281e05}, {0x000013bd, 0x282302}, {0x000006e1, 0x28250a}, {0x0000007c, 0x282f03},
+    {0x000000c0, 0x283206}, {0x000004d3, 0x283807}, {0x0100285d, 0x283f12}, {0x1004ff42, 0x28510b},
+    {0x0000fe64, 0x285c0f}, {0x01000da3, 0x286b08}, {0x1008ff78, 0x28730c}, {0x01001ea7, 0x287f10},
+    {0x0100056c, 0x288f0d}, {0x0100056b, 0x289c0c}, {0x0000fe54, 0x28a80b}, {0x100811b0, 0x28b30e},
+    {0x01002828, 0x28c10f}, {0x00000daf, 0x28d00c}, {0x01002841, 0x28dc0f}, {0x0100286b, 0x28eb12},
+    {0x00000dba, 0x28fd0d}, {0x0000ff57, 0x290a03}, {0x000009e0, 0x290d0c}, {0x1008ff25, 0x29190f},
+    {0x000005d6, 0x29280a}, {0x1008129c, 0x29320b}, {0x100812a9, 0x293d0b}, {0x0000007e, 0x29480a},
+    {0x1000fe27, 0x29520d}, {0x01001ed1, 0x295f10}, {0x1008ff26, 0x296f08}, {0x00000dc3, 0x29770a},
+    {0x0000fe75, 0x298111}, {0x0000fe51, 0x29920a}, {0x0000002c, 0x299c05}, {0x01000d95, 0x29a107},
+    {0x000000e8, 0x29a806}, {0x01002856, 0x29ae11}, {0x01000d93, 0x29bf07}, {0x000008db, 0x29c608},
+    {0x000007a1, 0x29ce11}, {0x0000007d, 0x29df0a}, {0x0000fe76, 0x29e910}, {0x000000f5, 0x29f906},
+    {0x0000fe5f, 0x29ff15}, {0x00000ad0, 0x2a1413}, {0x000009ea, 0x2a270e}, {0x01000dd1, 0x2a3509},
+    {0x000001b2, 0x2a3e06}, {0x00000ad6, 0x2a4407}, {0x0100053c, 0x2a4b0d}, {0x00000ade, 0x2a580e},
+    {0x00000ef4, 0x2a6619}, {0x1008ffa8, 0x2a7f0d}, {0x000003c0, 0x2a8c07}, {0x00000072, 0x2a9301},
+    {0x1008ff3f, 0x2a940f}, {0x0000fe24, 0x2aa315}, {0x000003a2, 0x2ab803}, {0x01001edf, 0x2abb09},
+    {0x000008f6, 0x2ac408}, {0x000000f7, 0x2acc08}, {0x01000666, 0x2ad408}, {0x000003dd, 0x2adc06},
+    {0x1004ff73, 0x2ae20b}, {0x10081279, 0x2aed17}, {0x000007cd, 0x2b0408}, {0x1004ff03, 0x2b0c06},
+    {0x0000fee9, 0x2b120f}, {0x01000497, 0x2b2116}, {0x1008ff16, 0x2b370d}, {0x10081275, 0x2b440f},
+    {0x010004ba, 0x2b530d}, {0x1008ff52, 0x2b6008}, {0x000001af, 0x2b6809}, {0x00000aa4, 0x2b7108},
+    {0x000008c9, 0x2b790c}, {0x1008fe25, 0x2b850f}, {0x1008ff6a, 0x2b940e}, {0x0000ff61, 0x2ba205},
+    {0x01000d86, 0x2ba707}, {0x01001edb, 0x2bae0a}, {0x1008ff9a, 0x2bb80c}, {0x0000ff32, 0x2bc40c},
+    {0x01001ea1, 0x2bd009}, {0x000003f1, 0x2bd908}, {0x1008ff8a, 0x2be108}, {0x1008ff77, 0x2be908},
+    {0x000001fe, 0x2bf108}, {0x00000edf, 0x2bf912}, {0x1008ff44, 0x2c0b0b}, {0x01000d94, 0x2c1606},
+    {0x00000ceb, 0x2c1c0b}, {0x0100289b, 0x2c2712}, {0x01002075, 0x2c390c}, {0x10081244, 0x2c450d},
+    {0x0000003f, 0x2c5208}, {0x0000003c, 0x2c5a04}, {0x000008a1, 0x2c5e0b}, {0x01002881, 0x2c690f},
+    {0x000001ca, 0x2c7807}, {0x0000fea1, 0x2c7f02}, {0x000001d2, 0x2c8106}, {0x0000ffd7, 0x2c8703},
+    {0x0000fe72, 0x2c8a11}, {0x000001aa, 0x2c9b08}, {0x100811bd, 0x2ca30f}, {0x000005e3, 0x2cb20a},
+    {0x1005ff74, 0x2cbc08}, {0x010010d1, 0x2cc40c}, {0x0100281d, 0x2cd011}, {0x0000fe61, 0x2ce109},
+    {0x0000fef2, 0x2cea11}, {0x00000db1, 0x2cfb12}, {0x1005ff10, 0x2d0d06}, {0x00000bc0, 0x2d1307},
+    {0x000005c9, 0x2d1a11}, {0x00000078, 0x2d2b01}, {0x000007ee, 0x2d2c08}, {0x1008fe04, 0x2d340f},
+    {0x000007d8, 0x2d4309}, {0x01001e1e, 0x2d4c09}, {0x0000ffe0, 0x2d5503}, {0x000000e5, 0x2d5805},
+    {0x000006ea, 0x2d5d0f}, {0x01000177, 0x2d6c0b}, {0x0000ff2f, 0x2d770a}, {0x1008ff11, 0x2d8114},
+    {0x0000fe70, 0x2d950e}, {0x000006aa, 0x2da30c}, {0x100811ad, 0x2daf0f}, {0x010001b7, 0x2dbe03},
+    {0x01000691, 0x2dc10b}, {0x000000d8, 0x2dcc06}, {0x1004ff51, 0x2dd207}, {0x000000d3, 0x2dd906},
+    {0x1008ff5f, 0x2ddf06}, {0x00000dd2, 0x2de50b}, {0x000005e7, 0x2df009}, {0x0000fd1d, 0x2df910},
+    {0x1008ff55, 0x2e0909}, {0x1008ff86, 0x2e120b}, {0x01002854, 0x2e1d10}, {0x1008ff56, 0x2e2d09},
+    {0x1008ff50, 0x2e3613}, {0x000006d4, 0x2e490b}, {0x01002816, 0x2e5410}, {0x00000ef6, 0x2e640c},
+    {0x01002808, 0x2e700e}, {0x000006f7, 0x2e7e0b}, {0x010001b6, 0x2e8907}, {0x000004ac, 0x2e9007},
+    {0x01002089, 0x2e970d}, {0x0100281a, 0x2ea410}, {0x01000d85, 0x2eb406}, {0x0000ff80, 0x2eba08},
+    {0x00000cf8, 0x2ec20b}, {0x01000d90, 0x2ecd08}, {0x00000aa7, 0x2ed509}, {0x0000fe93, 0x2ede17},
+    {0x000005e6, 0x2ef50b}, {0x1008ff06, 0x2f0015}, {0x010010d5, 0x2f150c}, {0x100811bc, 0x2f2116},
+    {0x0000ff2a, 0x2f370f}, {0x00000afc, 0x2f4605}, {0x0000ffb8, 0x2f4b04}, {0x00000ac6, 0x2f4f0c},
+    {0x000006a9, 0x2f5b0c}, {0x00000064, 0x2f6701}, {0x01001ec3, 0x2f680f}, {0x00000af7, 0x2f770a},
+    {0x0000fe68, 0x2f8110}, {0x10081266, 0x2f910b}, {0x000006f1, 0x2f9c0b}, {0x000001ff, 0x2fa708},
+    {0x01000174, 0x2faf0b}, {0x1008ff34, 0x2fba0e}, {0x0000ffb3, 0x2fc804}, {0x1008ff21, 0x2fcc0d},
+    {0x0000fe6f, 0x2fd90d}, {0x01002804, 0x2fe60e}, {0x000003bb, 0x2ff408}, {0x01000555, 0x2ffc0a},
+    {0x000005bb, 0x300610}, {0x01000533, 0x30160c}, {0x0000ff31, 0x302206}, {0x1008ff8d, 0x302808},
+    {0x000001e5, 0x303006}, {0x000003a6, 0x303608}, {0x010028c5, 0x303e11}, {0x000000d9, 0x304f06},
+    {0x000004c9, 0x305507}, {0x00000ee0, 0x305c13}, {0x0000ffd2, 0x306f03}, {0x00000eb9, 0x307211},
+    {0x1008ff88, 0x30830f}, {0x100812bc, 0x30920f}, {0x000003d2, 0x30a107}, {0x01001ee6, 0x30a805},
+    {0x00000df8, 0x30ad0c}, {0x00000cea, 0x30b910}, {0x000006d6, 0x30c90c}, {0x000007d1, 0x30d509},
+    {0x000009ec, 0x30de0c}, {0x1008ff54, 0x30ea0e}, {0x00000dc7, 0x30f80b}, {0x000001cc, 0x310306},
+    {0x0000fe01, 0x310908}, {0x000008dd, 0x311105}, {0x000000bd, 0x311607}, {0x010004b1, 0x311d17},
+    {0x01000309, 0x31340e}, {0x0000ff29, 0x314207}, {0x000008b7, 0x314914}, {0x01000d89, 0x315d06},
+    {0x1008fe22, 0x31630e}, {0x10081240, 0x317110}, {0x1008ff32, 0x31810e}, {0x010010f1, 0x318f0b},
+    {0x01002877, 0x319a13}, {0x010028ab, 0x31ad12}, {0x000001d9, 0x31bf05}, {0x0000006a, 0x31c401},
+    {0x00000ed2, 0x31c509}, {0x01001e02, 0x31ce09}, {0x01002847, 0x31d711}, {0x01002820, 0x31e80e},
+    {0x000020ac, 0x31f608}, {0x0000ff35, 0x31fe0b}, {0x000007c8, 0x32090b}, {0x01000531, 0x32140c},
+    {0x000009e4, 0x322002}, {0x1008ff91, 0x32220c}, {0x0000ff51, 0x322e04}, {0x000001bd, 0x32320b},
+    {0x00000ac4, 0x323d0c}, {0x00000ce5, 0x32490a}, {0x01002830, 0x32530f}, {0x0000ff58, 0x326205},
+    {0x1008ff49, 0x32670b}, {0x010028a3, 0x327211}, {0x01002800, 0x32830d}, {0x00000ece, 0x329009},
+    {0x000003cc, 0x329909}, {0x000000b8, 0x32a207}, {0x00000cf4, 0x32a909}, {0x0000fef8, 0x32b20d},
+    {0x01001eae, 0x32bf0b}, {0x1008ff1f, 0x32ca0c}, {0x000000c7, 0x32d608}, {0x000002b9, 0x32de08},
+    {0x01000db7, 0x32e608}, {0x01002822, 0x32ee0f}, {0x0000ff9c, 0x32fd06}, {0x000006ac, 0x33030d},
+    {0x00000dca, 0x33100a}, {0x01000548, 0x331a0b}, {0x01002235, 0x332507}, {0x0000fe78, 0x332c0f},
+    {0x01001eee, 0x333b0a}, {0x000001fb, 0x33450c}, {0x01001ee5, 0x335109}, {0x1008ff1d, 0x335a0e},
+    {0x0000fd11, 0x33680d}, {0x00000aa2, 0x337507}, {0x000006b5, 0x337c0d}, {0x0100054e, 0x33890c},
+    {0x000003ec, 0x339509}, {0x010028b4, 0x339e11}, {0x000000bc, 0x33af0a}, {0x0000ffea, 0x33b905},
+    {0x0000fefa, 0x33be12}, {0x000006b2, 0x33d00d}, {0x00000ef5, 0x33dd12}, {0x01000669, 0x33ef08},
+    {0x01000563, 0x33f70c}, {0x01001ef7, 0x340305}, {0x01000dd2, 0x340807}, {0x0000feee, 0x340f15},
+    {0x000007e6, 0x34240a}, {0x100812aa, 0x342e0b}, {0x1004ff53, 0x343908}, {0x01000dda, 0x344108},
+    {0x1004ff1b, 0x344909}, {0x010006f2, 0x345207}, {0x0000fe62, 0x345909}, {0x000008c1, 0x346209},
+    {0x01000dc2, 0x346b09}, {0x01000db3, 0x347409}, {0x01002825, 0x347d10}, {0x0100220b, 0x348d0a},
+    {0x01002809, 0x34970f}, {0x000000f1, 0x34a606}, {0x01000568, 0x34ac0b}, {0x1008ff4c, 0x34b70b},
+    {0x000004c8, 0x34c207}, {0x000003bd, 0x34c903}, {0x00000acb, 0x34cc11}, {0x00000dd8, 0x34dd0a},
+    {0x000005e2, 0x34e70a}, {0x010028f9, 0x34f113}, {0x0000ff14, 0x35040b}, {0x1008ff43, 0x350f0b},
+    {0x000007f7, 0x351a09}, {0x01002812, 0x35230f}, {0x01001ef8, 0x353206}, {0x00000049, 0x353801},
+    {0x00000dc2, 0x35390a}, {0x000001c6, 0x354306}, {0x000006b4, 0x35490c}, {0x01002827, 0x355511},
+    {0x000003f9, 0x356607}, {0x1008fe06, 0x356d0f}, {0x010010d6, 0x357c0c}, {0x0000fd0a, 0x358808},
+    {0x000002a1, 0x359007}, {0x000000a3, 0x359708}, {0x1008121c, 0x359f10}, {0x1000ff6d, 0x35af08},
+    {0x010028ae, 0x35b712}, {0x0000fd19, 0x35c911}, {0x01000654, 0x35da12}, {0x0000fea4, 0x35ec03},
+    {0x000001bb, 0x35ef06}, {0x10081242, 0x35f50b}, {0x000007ba, 0x36001b}, {0x000007e8, 0x361b0b},
+    {0x0000fe79, 0x36260f}, {0x01001e6b, 0x363509}, {0x000001ef, 0x363e06}, {0x000008b5, 0x364411},
+    {0x000007f2, 0x36550b}, {0x000008b1, 0x366010}, {0x0100049b, 0x367015}, {0x010010e4, 0x36850d},
+    {0x000002d8, 0x36920b}, {0x1005ff71, 0x369d08}, {0x000002e6, 0x36a50b}, {0x010006f7, 0x36b007},
+    {0x1008ff95, 0x36b708}, {0x00000deb, 0x36bf10}, {0x00000aa8, 0x36cf09}, {0x1004ff32, 0x36d80f},
+    {0x01000542, 0x36e70d}, {0x00000db9, 0x36f409}, {0x0000ff9a, 0x36fd08}, {0x000003b6, 0x370508},
+    {0x010004b3, 0x370d15}, {0x00000ce8, 0x37220a}, {0x000007e2, 0x372c0a}, {0x0000ff2d, 0x373609},
+    {0x1008ff46, 0x373f0b}, {0x0100057c, 0x374a0b}, {0x0100055b, 0x37550f}, {0x000002c6, 0x37640b},
+    {0x000007ea, 0x376f0b}, {0x010004d9, 0x377a0e}, {0x010028a2, 0x378810}, {0x0000fed1, 0x379813},
+    {0x1008126f, 0x37ab0a}, {0x010020a9, 0x37b507}, {0x00000dd1, 0x37bc0f}, {0x00000ae1, 0x37cb12},
+    {0x000006c6, 0x37dd0b}, {0x010010eb, 0x37e80c}, {0x1008ff9b, 0x37f413}, {0x0000fe74, 0x380711},
+    {0x010010d7, 0x38180c}, {0x0000ff91, 0x382405}, {0x01001ee8, 0x38290a}, {0x000000c9, 0x383306},
+    {0x000006e4, 0x38390b}, {0x01000576, 0x38440b}, {0x00000ad4, 0x384f0c}, {0x000004a8, 0x385b06},
+    {0x1008ffb7, 0x386116}, {0x000004be, 0x387707}, {0x000000b1, 0x387e09}, {0x01000660, 0x388708},
+    {0x000006c9, 0x388f0a}, {0x10081276, 0x38990f}, {0x10081260, 0x38a816}, {0x000000cb, 0x38be0a},
+    {0x1008ff5c, 0x38c809}, {0x01002866, 0x38d111}, {0x00000af3, 0x38e209}, {0x000000e3, 0x38eb06},
+    {0x00000abe, 0x38f111}, {0x0000fe90, 0x39020c}, {0x0100280a, 0x390e0f}, {0x01000579, 0x391d0c},
+    {0x000000ee, 0x39290b}, {0x00000045, 0x393401}, {0x000007c9, 0x39350a}, {0x0000ff3c, 0x393f0f},
+    {0x00000bc3, 0x394e06}, {0x0100057e, 0x39540c}, {0x01002898, 0x396010}, {0x000000a8, 0x397009},
+    {0x1004ff54, 0x397907}, {0x100812ad, 0x39800b}, {0x000006d7, 0x398b0b}, {0x000007a4, 0x399610},
+    {0x000008fe, 0x39a609}, {0x0000fe0d, 0x39af14}, {0x0000ff2e, 0x39c30a}, {0x00000055, 0x39cd01},
+    {0x000005f2, 0x39ce0c}, {0x00000dcc, 0x39da0c}, {0x00000efa, 0x39e614}, {0x000009f1, 0x39fa0e},
+    {0x01000663, 0x3a0808}, {0x1008127a, 0x3a1017}, {0x0000fe06, 0x3a270f}, {0x00000ae8, 0x3a3611},
+    {0x010028e8, 0x3a4711}, {0x0100057a, 0x3a580b}, {0x10081298, 0x3a630a}, {0x1008ff9c, 0x3a6d0e},
+    {0x01002852, 0x3a7b10}, {0x0100054b, 0x3a8b0b}, {0x01001ed6, 0x3a9610}, {0x0000feef, 0x3aa611},
+    {0x000009f2, 0x3ab70e}, {0x01000db9, 0x3ac508}, {0x1008ffa0, 0x3acd0a}, {0x1008ff29, 0x3ad70b},
+    {0x000008dc, 0x3ae20c}, {0x0000ffaa, 0x3aee0b}, {0x0000ffb1, 0x3af904}, {0x0100056d, 0x3afd0c},
+    {0x00000de6, 0x3b090d}, {0x0100288e, 0x3b1611}, {0x01000dc4, 0x3b2707}, {0x01002811, 0x3b2e0f},
+    {0x000001de, 0x3b3d08}, {0x00000041, 0x3b4501}, {0x0000feea, 0x3b460f}, {0x01000d88, 0x3b5508},
+    {0x01000da1, 0x3b5d08}, {0x00000edd, 0x3b6513}, {0x010004ef, 0x3b7811}, {0x00000bce, 0x3b8906},
+    {0x01000540, 0x3b8f0b}, {0x000006b3, 0x3b9a0b}, {0x010028e1, 0x3ba511}, {0x0000ff23, 0x3bb60b},
+    {0x01000dc1, 0x3bc108}, {0x01000ddf, 0x3bc908}, {0x01002823, 0x3bd110}, {0x00000db4, 0x3be10a},
+    {0x0000ff50, 0x3beb04}, {0x1004ff52, 0x3bef05}, {0x1008ff75, 0x3bf40e}, {0x000000b2, 0x3c020b},
+    {0x01000da0, 0x3c0d07}, {0x1004ff08, 0x3c140c}, {0x01002888, 0x3c200f}, {0x010028cd, 0x3c2f12},
+    {0x00000ad3, 0x3c4114}, {0x01001ef9, 0x3c5506}, {0x00000eec, 0x3c5b0e}, {0x0000ffab, 0x3c6906},
+    {0x01001e0a, 0x3c6f09}, {0x00000027, 0x3c780a}, {0x010010dc, 0x3c820c}, {0x000002f8, 0x3c8e0b},
+    {0x0100286f, 0x3c9913}, {0x1008126a, 0x3cac0c}, {0x00000dcd, 0x3cb809}, {0x01002826, 0x3cc110},
+    {0x00000af0, 0x3cd10c}, {0x01000549, 0x3cdd0c}, {0x1008121a, 0x3ce90f}, {0x000003bf, 0x3cf803},
+    {0x01001ef6, 0x3cfb05}, {0x000006d3, 0x3d000b}, {0x0000fd02, 0x3d0b0e}, {0x1004ff63, 0x3d1909},
+    {0x1008ff6b, 0x3d2208}, {0x0100222c, 0x3d2a09}, {0x00000dde, 0x3d3316}, {0x00000df7, 0x3d490c},
+    {0x0000ff37, 0x3d5509}, {0x00000ee2, 0x3d5e13}, {0x0000fe0a, 0x3d710e}, {0x100812a5, 0x3d7f0b},
+    {0x010006f8, 0x3d8a07}, {0x1008120d, 0x3d910c}, {0x00000af9, 0x3d9d09}, {0x1008ff67, 0x3da60b},
+    {0x00000ee7, 0x3db112}, {0x1008ffa2, 0x3dc30b}, {0x1008129d, 0x3dce0b}, {0x01002829, 0x3dd910},
+    {0x10081294, 0x3de90a}, {0x10081201, 0x3df30c}, {0x10081245, 0x3dff0f}, {0x0100289e, 0x3e0e12},
+    {0x000000bf, 0x3e200c}, {0x010028a9, 0x3e2c11}, {0x000003c7, 0x3e3d07}, {0x000000e0, 0x3e4406},
+    {0x000000c8, 0x3e4a06}, {0x000007e4, 0x3e500b}, {0x000000ab, 0x3e5b0d}, {0x01002861, 0x3e6810},
+    {0x10081265, 0x3e7818}, {0x0100287d, 0x3e9013}, {0x010020ab, 0x3ea308}, {0x0000fe8c, 0x3eab0a},
+    {0x0000fefd, 0x3eb50d}, {0x000008fc, 0x3ec207}, {0x010010f0, 0x3ec90c}, {0x0000fee7, 0x3ed511},
+    {0x1008ff4a, 0x3ee60b}, {0x0000ffd4, 0x3ef103}, {0x01000dd3, 0x3ef408}, {0x00000077, 0x3efc01},
+    {0x000009e9, 0x3efd02}, {0x0000fe63, 0x3eff0b}, {0x00000ede, 0x3f0a13}, {0x010028a8, 0x3f1d10},
+    {0x000007a2, 0x3f2d13}, {0x000005c3, 0x3f4012}, {0x01001ee1, 0x3f520a}, {0x00000038, 0x3f5c01},
+    {0x1008ff59, 0x3f5d0b}, {0x1008126c, 0x3f680d}, {0x0000fd08, 0x3f750a}, {0x000007d0, 0x3f7f08},
+    {0x010006f1, 0x3f8707}, {0x010006f6, 0x3f8e07}, {0x00000eb6, 0x3f9510}, {0x01000571, 0x3fa50c},
+    {0x00000aac, 0x3fb10b}, {0x010028b9, 0x3fbc12}, {0x01000550, 0x3fce0b}, {0x1004ff5b, 0x3fd90b},
+    {0x0000ffc3, 0x3fe402}, {0x00000dcb, 0x3fe60a}, {0x01002080, 0x3ff00d}, {0x01002209, 0x3ffd0c},
+    {0x000006bf, 0x40090d}, {0x010010f2, 0x40160c}, {0x0000fe6e, 0x40220f}, {0x01001eac, 0x403113},
+    {0x1008ff96, 0x404407}, {0x00000ef1, 0x404b18}, {0x000006cf, 0x40630a}, {0x01000303, 0x406d0f},
+    {0x1008ff5e, 0x407c08}, {0x010004e3, 0x408411}, {0x010028fa, 0x409513}, {0x10081210, 0x40a80f},
+    {0x000005cb, 0x40b70b}, {0x010010e3, 0x40c20b}, {0x01000da2, 0x40cd07}, {0x00000ed5, 0x40d414},
+    {0x000004ae, 0x40e807}, {0x000001ab, 0x40ef06}, {0x1008124a, 0x40f50b}, {0x1008ff58, 0x410007},
+    {0x000005e5, 0x41070b}, {0x0100281b, 0x411211}, {0x100812ba, 0x41230f}, {0x00000ba3, 0x413209},
+    {0x0000feed, 0x413b0f}, {0x000003fe, 0x414a07}, {0x01002855, 0x415111}, {0x1005ff04, 0x41620f},
+    {0x1008ff42, 0x41710b}, {0x010020a7, 0x417c0a}, {0x000003ab, 0x418608}, {0x01001e84, 0x418e0a},
+    {0x0100283e, 0x419812}, {0x01000db1, 0x41aa07}, {0x1000fe60, 0x41b10d}, {0x000004a7, 0x41be06},
+    {0x01001ec6, 0x41c413}, {0x01001eb6, 0x41d70e}, {0x00000ac9, 0x41e509}, {0x1005ff78, 0x41ee0c},
+    {0x000006db, 0x41fa0c}, {0x00000da1, 0x42060a}, {0x010006f4, 0x421007}, {0x00000ef8, 0x421710},
+    {0x000007f3, 0x422715}, {0x000007c2, 0x423c0a}, {0x00000cec, 0x42460c}, {0x01000d9c, 0x425207},
+    {0x0000ff20, 0x425909}, {0x0000fe2d, 0x426215}, {0x01000259, 0x427705}, {0x1000ff00, 0x427c07},
+    {0x01001e0b, 0x428309}, {0x0000ffcc, 0x428c03}, {0x1005ff7a, 0x428f0f}, {0x010028ac, 0x429e11},
+    {0x1008126d, 0x42af0d}, {0x000007f8, 0x42bc09}, {0x01002878, 0x42c511}, {0x0000fe6d, 0x42d612},
+    {0x000001c3, 0x42e806}, {0x00000067, 0x42ee01}, {0x01002863, 0x42ef11}, {0x010028e2, 0x430011},
+    {0x00000de9, 0x43110b}, {0x01000d91, 0x431c06}, {0x1005ff73, 0x432207}, {0x0100221c, 0x43290a},
+    {0x1008121d, 0x433313}, {0x01001ea4, 0x434610}, {0x01002860, 0x43560f}, {0x0100280c, 0x43650f},
+    {0x000004a5, 0x437410}, {0x000007ca, 0x43840b}, {0x1008ff15, 0x438f0d}, {0x0000fed5, 0x439c10},
+    {0x0000ffc5, 0x43ac02}, {0x0000fe12, 0x43ae10}, {0x000007ae, 0x43be14}, {0x00000035, 0x43d201},
+    {0x00000ea6, 0x43d311}, {0x000008b0, 0x43e415}, {0x01000292, 0x43f903}, {0x00000eea, 0x43fc0e},
+    {0x00000bd8, 0x440a09}, {0x01000574, 0x44130c}, {0x000008fd, 0x441f0a}, {0x1008ff98, 0x44290f},
+    {0x010028ec, 0x443812}, {0x0100282c, 0x444a10}, {0x000006a4, 0x445a0c}, {0x1008120e, 0x44660c},
+    {0x010001e7, 0x447206}, {0x00000eed, 0x44780f}, {0x0000fe21, 0x448710}, {0x00000ee4, 0x44970e},
+    {0x0000ff69, 0x44a506}, {0x000008a6, 0x44ab0d}, {0x000000de, 0x44b805}, {0x100811ba, 0x44bd0a},
+    {0x0000006d, 0x44c701}, {0x00000076, 0x44c801}, {0x000007b1, 0x44c911}, {0x01000d9f, 0x44da08},
+    {0x000007ef, 0x44e20d}, {0x10081203, 0x44ef0c}, {0x1008ff6c, 0x44fb0a}, {0x1008ff05, 0x450513},
+    {0x000004ab, 0x451806}, {0x0000ff0b, 0x451e05}, {0x0000005e, 0x45230b}, {0x1000ff75, 0x452e0c},
+    {0x000001b5, 0x453a06}, {0x01000dc6, 0x454007}, {0x000008d6, 0x454707}, {0x0000ffe7, 0x454e06},
+    {0x1000ff71, 0x45540c}, {0x01000539, 0x45600b}, {0x010006f9, 0x456b07}, {0x00000db3, 0x45720a},
+    {0x000000be, 0x457c0d}, {0x010028c4, 0x458910}, {0x0100288c, 0x459910}, {0x0000002a, 0x45a908},
+    {0x1008ff70, 0x45b105}, {0x00000afb, 0x45b613}, {0x000002de, 0x45c90b}, {0x000008de, 0x45d40a},
+    {0x0100054a, 0x45de0b}, {0x00000051, 0x45e901}, {0x1000ff49, 0x45ea0b}, {0x01000589, 0x45f512},
+    {0x00000ab2, 0x460708}, {0x010028a6, 0x460f11}, {0x000004ad, 0x462007}, {0x10081290, 0x46270a},
+    {0x1008ffb0, 0x46310e}, {0x1000fe22, 0x463f0a}, {0x0000fe2a, 0x464918}, {0x000006c4, 0x46610b},
+    {0x000005eb, 0x466c0f}, {0x10081204, 0x467b0c}, {0x0100285f, 0x468713}, {0x00000bda, 0x469a08},
+    {0x01001ecc, 0x46a209}, {0x010010e5, 0x46ab0d}, {0x1000fe5e, 0x46b812}, {0x01002248, 0x46ca08},
+    {0x010001b0, 0x46d205}, {0x0000fe53, 0x46d70a}, {0x00000037, 0x46e101}, {0x100000fc, 0x46e207},
+    {0x000004c5, 0x46e907}, {0x10081185, 0x46f007}, {0x00000bd3, 0x46f707}, {0x1008120b, 0x46fe10},
+    {0x00000021, 0x470e06}, {0x000006af, 0x47140d}, {0x000001b7, 0x472105}, {0x000004c3, 0x472607},
+    {0x0000fee4, 0x472d0e}, {0x000002ac, 0x473b0b}, {0x010028af, 0x474613}, {0x000007c4, 0x47590b},
+    {0x000004d9, 0x476407}, {0x00000acf, 0x476b0f}, {0x0000fd1c, 0x477a11}, {0x000007b5, 0x478b12},
+    {0x01000da5, 0x479d09}, {0x0000fe29, 0x47a617}, {0x000005d4, 0x47bd0c}, {0x01002086, 0x47c90c},
+    {0x00000db2, 0x47d50f}, {0x010020a2, 0x47e40c}, {0x000004a2, 0x47f013}, {0x010001a1, 0x480305},
+    {0x000001b9, 0x480806}, {0x100811b8, 0x480e10}, {0x01000546, 0x481e0b}, {0x1000feb0, 0x48290c},
+    {0x0000ffe1, 0x483507}, {0x01001e36, 0x483c09}, {0x1008ff84, 0x48450a}, {0x00000ee8, 0x484f0e},
+    {0x0000ff9e, 0x485d09}, {0x01002079, 0x48660c}, {0x0000ff39, 0x48720c}, {0x010028f8, 0x487e12},
+    {0x000008fb, 0x489009}, {0x1008ff13, 0x489914}, {0x00000dc1, 0x48ad09}, {0x00000ee6, 0x48b60d},
+    {0x000000ce, 0x48c30b}, {0x00000ae7, 0x48ce10}, {0x000006ff, 0x48de11}, {0x10081243, 0x48ef10},
+    {0x010010e7, 0x48ff0c}, {0x01002892, 0x490b10}, {0x0000ffb9, 0x491b04}, {0x0000fe11, 0x491f10},
+    {0x0000ff9d, 0x492f08}, {0x10081297, 0x49370a}, {0x0000ff8d, 0x494108}, {0x000000d7, 0x494908},
+    {0x0000ffed, 0x495107}, {0x01000575, 0x49580b}, {0x01001edd, 0x49630a}, {0x010028d6, 0x496d12},
+    {0x10081247, 0x497f0d}, {0x010004b8, 0x498c17}, {0x01001e80, 0x49a306}, {0x00000020, 0x49a905},
+    {0x01000175, 0x49ae0b}, {0x010028d9, 0x49b912}, {0x01000db6, 0x49cb07}, {0x1008ffb2, 0x49d210},
+    {0x00000dd9, 0x49e20b}, {0x000005ca, 0x49ed0a}, {0x0000fd06, 0x49f70d}, {0x00000dc8, 0x4a040b},
+    {0x000006c3, 0x4a0f0c}, {0x1008fe21, 0x4a1b0d}, {0x1008ff2c, 0x4a2809}, {0x00000ad5, 0x4a3108},
+    {0x000008bc, 0x4a390d}, {0x000004c2, 0x4a4608}, {0x1008120a, 0x4a4e0f}, {0x01001edc, 0x4a5d0a},
+    {0x1008ff8c, 0x4a670b}, {0x1008ff24, 0x4a720e}, {0x1008ff7a, 0x4a800f}, {0x0000fefb, 0x4a8f13},
+    {0x010028c8, 0x4aa210}, {0x000004a1, 0x4ab20d}, {0x01002202, 0x4abf10}, {0x01002836, 0x4acf11},
+    {0x0100286c, 0x4ae011}, {0x000003d1, 0x4af108}, {0x01001e61, 0x4af909}, {0x10081193, 0x4b020f},
+    {0x0100288d, 0x4b1111}, {0x010004e8, 0x4b220e}, {0x01001e83, 0x4b3006}, {0x0000ff15, 0x4b3607},
+    {0x0000fe31, 0x4b3d1b}, {0x00000ae4, 0x4b5811}, {0x100000ee, 0x4b690c}, {0x0100054c, 0x4b750b},
+    {0x00000af5, 0x4b800c}, {0x000005ee, 0x4b8c0c}, {0x01000661, 0x4b9808}, {0x10081292, 0x4ba00a},
+    {0x00000034, 0x4baa01}, {0x1008ffa9, 0x4bab12}, {0x000005ed, 0x4bbd0f}, {0x0000fea0, 0x4bcc02},
+    {0x0000ffc8, 0x4bce03}, {0x0000ff96, 0x4bd107}, {0x00000ad9, 0x4bd80a}, {0x0000ffe5, 0x4be209},
+    {0x0000ff9b, 0x4beb07}, {0x100811be, 0x4bf20f}, {0x000001d5, 0x4c010c}, {0x00000de8, 0x4c0d0a},
+    {0x01002832, 0x4c1710}, {0x10081241, 0x4c270f}, {0x1008fe03, 0x4c360f}, {0x0000002f, 0x4c4505},
+    {0x01000daa, 0x4c4a09}, {0x0000fff5, 0x4c530d}, {0x01000577, 0x4c600c}, {0x010006c1, 0x4c6c0f},
+    {0x01000537, 0x4c7b0a}, {0x00000ba6, 0x4c850a}, {0x01000566, 0x4c8f0b}, {0x000006bb, 0x4c9a0c},
+    {0x000005e1, 0x4ca60a}, {0x01001ea5, 0x4cb010}, {0x0000ffd5, 0x4cc003}, {0x01000dca, 0x4cc307},
+    {0x010001b5, 0x4cca07}, {0x000007d4, 0x4cd109}, {0x000007ab, 0x4cda11}, {0x0000ffb5, 0x4ceb04},
+    {0x000004d4, 0x4cef07}, {0x10081262, 0x4cf61b}, {0x00000dab, 0x4d1109}, {0x0000ff09, 0x4d1a03},
+    {0x00000df2, 0x4d1d0c}, {0x01000586, 0x4d290b}, {0x1005ff60, 0x4d340a}, {0x01000565, 0x4d3e0d},
+    {0x0100286e, 0x4d4b12}, {0x0000004f, 0x4d5d01}, {0x000001f9, 0x4d5e05}, {0x0000ff6a, 0x4d6304},
+    {0x1008120c, 0x4d670c}, {0x0000ffec, 0x4d7307}, {0x0000ffcd, 0x4d7a03}, {0x000008ef, 0x4d7d11},
+    {0x0100286d, 0x4d8e12}, {0x0000fe57, 0x4da00e}, {0x1004ff57, 0x4dae0a}, {0x000009ee, 0x4db80d},
+    {0x01001e6a, 0x4dc509}, {0x00000aa3, 0x4dce08}, {0x000000d6, 0x4dd60a}, {0x1008119b, 0x4de009},
+    {0x00000eb5, 0x4de90b}, {0x0000ffc7, 0x4df403}, {0x00000df9, 0x4df70b}, {0x000007b8, 0x4e0213},
+    {0x010006f5, 0x4e1507}, {0x01002851, 0x4e1c10}, {0x10081250, 0x4e2c11}, {0x0000ff92, 0x4e3d05},
+    {0x1008ffa1, 0x4e4208}, {0x0000ffbf, 0x4e4a02}, {0x010001a0, 0x4e4c05}, {0x0100281e, 0x4e5111},
+    {0x00000ed1, 0x4e6209}, {0x000009f5, 0x4e6b06}, {0x000001cf, 0x4e7106}, {0x000002fd, 0x4e7706},
+    {0x00000da6, 0x4e7d0f}, {0x000001c8, 0x4e8c06}, {0x1008ff2e, 0x4e9207}, {0x1008ffb1, 0x4e990f},
+    {0x1005ff05, 0x4ea80d}, {0x1000ff74, 0x4eb509}, {0x010028b1, 0x4ebe11}, {0x100812ab, 0x4ecf0b},
+    {0x00000073, 0x4eda01}, {0x010028f3, 0x4edb13}, {0x0000003b, 0x4eee09}, {0x01002880, 0x4ef70e},
+    {0x1005ff02, 0x4f050b}, {0x00000da2, 0x4f100c}, {0x00000abf, 0x4f1c06}, {0x01002817, 0x4f2211},
+    {0x100811e5, 0x4f3310}, {0x0000ff55, 0x4f4305}, {0x00000079, 0x4f4801}, {0x1008ff1b, 0x4f490a},
+    {0x01002262, 0x4f530c}, {0x010028ee, 0x4f5f13}, {0x0000ffff, 0x4f7206}, {0x00000ecb, 0x4f7809},
+    {0x1008ff90, 0x4f810f}, {0x010028ff, 0x4f9015}, {0x000002b1, 0x4fa507}, {0x000005c6, 0x4fac11},
+    {0x0000ff3d, 0x4fbd11}, {0x01001ea8, 0x4fce0f}, {0x01002814, 0x4fdd0f}, {0x0000fe58, 0x4fec0e},
+    {0x0000fe03, 0x4ffa10}, {0x10081264, 0x500a18}, {0x01001ef3, 0x502206}, {0x01000dba, 0x502807},
+    {0x000003f2, 0x502f07}, {0x01000da4, 0x503608}, {0x100812a6, 0x503e0b}, {0x100812b2, 0x504914},
+    {0x000008ab, 0x505d0d}, {0x01001ead, 0x506a13}, {0x00000eae, 0x507d11}, {0x000000c5, 0x508e05},
+    {0x00000ee9, 0x50930e}, {0x000005d0, 0x50a10b}, {0x1008ff17, 0x50ac0d}, {0x000006d8, 0x50b911},
+    {0x010010d4, 0x50ca0b}, {0x01002894, 0x50d510}, {0x010010ec, 0x50e50c}, {0x01000275, 0x50f107},
+    {0x0000ff3b, 0x50f810}, {0x00000cfa, 0x51080a}, {0x010028b3, 0x511212}, {0x000006d5, 0x51240a},
+    {0x00000df4, 0x512e0a}, {0x00000eaa, 0x513812}, {0x000000fb, 0x514a0b}, {0x100812a8, 0x51550b},
+    {0x000004ca, 0x516007}, {0x000001f5, 0x51670c}, {0x100812b0, 0x517314}, {0x0000fe20, 0x51870c},
+    {0x00000af2, 0x51930c}, {0x01002874, 0x519f11}, {0x00000dea, 0x51b00b}, {0x00000ebf, 0x51bb08},
+    {0x00000ab7, 0x51c30a}, {0x0000fe2f, 0x51cd14}, {0x01001eda, 0x51e10a}, {0x000006b7, 0x51eb0c},
+    {0x01000dab, 0x51f708}, {0x0000fe87, 0x51ff06}, {0x00000ae6, 0x520512}, {0x01002885, 0x521710},
+    {0x0000ffce, 0x522703}, {0x01002077, 0x522a0d}, {0x000007d2, 0x52370b}, {0x00000ed4, 0x52420f},
+    {0x01002882, 0x52510f}, {0x000007c6, 0x52600a}, {0x0100283a, 0x526a11}, {0x010028f6, 0x527b13},
+    {0x100811a9, 0x528e10}, {0x00000aff, 0x529e06}, {0x1008ff35, 0x52a40d}, {0x01001eef, 0x52b10a},
+    {0x000000d0, 0x52bb03}, {0x000005ac, 0x52be0c}, {0x000008c5, 0x52ca05}, {0x00000057, 0x52cf01},
+    {0x000001ec, 0x52d006}, {0x01002846, 0x52d610}, {0x000000b4, 0x52e605}, {0x000009e3, 0x52eb02},
+    {0x000009ed, 0x52ed0d}, {0x100812b8, 0x52fa0f}, {0x00000bcc, 0x530904}, {0x000006a7, 0x530d0c},
+    {0x0000ff0d, 0x531906}, {0x000007a3, 0x531f0f}, {0x0000fd16, 0x532e09}, {0x010010e2, 0x53370c},
+    {0x1008ff19, 0x534308}, {0x01002084, 0x534b0d}, {0x01001ed8, 0x535813}, {0x000009f6, 0x536b04},
+    {0x01001ec5, 0x536f10}, {0x000004c1, 0x537f08}, {0x0100055e, 0x538711}, {0x00000add, 0x539814},
+    {0x00000df5, 0x53ac0a}, {0x1008ff87, 0x53b609}, {0x01001ede, 0x53bf09}, {0x1008ff41, 0x53c80b},
+    {0x00000af1, 0x53d306}, {0x01002845, 0x53d910}, {0x100810f5, 0x53e90e}, {0x000000b6, 0x53f709},
+    {0x010028d0, 0x540010}, {0x000006fa, 0x54100b}, {0x000004bd, 0x541b07}, {0x00000ed0, 0x542209},
+    {0x01001ef1, 0x542b0d}, {0x1008ff8e, 0x54380d}, {0x00000dac, 0x54450c}, {0x00000022, 0x545108},
+    {0x01000562, 0x54590c}, {0x010028be, 0x546513}, {0x010028a1, 0x547810}, {0x0100289a, 0x548811},
+    {0x000005ec, 0x54990f}, {0x00000ea4, 0x54a80c}, {0x0000ff7f, 0x54b408}, {0x00000ed3, 0x54bc08},
+    {0x01002837, 0x54c412}, {0x01000534, 0x54d60b}, {0x00000adb, 0x54e110}, {0x01000db5, 0x54f108},
+    {0x1008ffb8, 0x54f90e}, {0x000006f9, 0x55070d}, {0x010010e0, 0x55140c}, {0x000005da, 0x55200c},
+    {0x1008ff73, 0x552c0a}, {0x000003bc, 0x553606}, {0x1008ff01, 0x553c0c}, {0x01000dd4, 0x554807},
+    {0x00000aee, 0x554f05}, {0x0000fff3, 0x55540d}, {0x00000daa, 0x55610d}, {0x00000ab1, 0x556e09},
+    {0x00000cf1, 0x55770d}, {0x01000662, 0x558408}, {0x10081277, 0x558c08}, {0x01002891, 0x559410},
+    {0x010028c0, 0x55a40f}, {0x0000ffc9, 0x55b303}, {0x100811b7, 0x55b60f}, {0x000006d1, 0x55c50b},
+    {0x010020a6, 0x55d009}, {0x000003f3, 0x55d908}, {0x01000dde, 0x55e108}, {0x000000a6, 0x55e909},
+    {0x0000fe50, 0x55f20a}, {0x100812b4, 0x55fc10}, {0x1008ff22, 0x560c12}, {0x0000ffbd, 0x561e08},
+    {0x100811a6, 0x56260a}, {0x00000ec6, 0x563009}, {0x01002859, 0x563911}, {0x000004b6, 0x564a07},
+    {0x00000cf3, 0x56510e}, {0x010020a1, 0x565f09}, {0x0100053b, 0x56680c}, {0x010028c6, 0x567411},
+    {0x000006b6, 0x56850b}, {0x0000ff66, 0x569004}, {0x00000ab0, 0x569408}, {0x00000abb, 0x569c07},
+    {0x01000584, 0x56a30b}, {0x0000ffde, 0x56ae03}, {0x00000050, 0x56b101}, {0x1008ff14, 0x56b20d},
+    {0x000005c7, 0x56bf0b}, {0x000000e6, 0x56ca02}, {0x00000054, 0x56cc01}, {0x01000dd6, 0x56cd08},
+    {0x10081267, 0x56d50d}, {0x0000ffc6, 0x56e202}, {0x1008ff5b, 0x56e40d}, {0x00000075, 0x56f101},
+    {0x0000ff65, 0x56f204}, {0x100812a4, 0x56f60b}, {0x000007c7, 0x570109}, {0x000007b9, 0x570a15},
+    {0x1004ff74, 0x571f09}, {0x0000fe73, 0x57280f}, {0x10081192, 0x57370d}, {0x000005d9, 0x57440a},
+    {0x00000db7, 0x574e0e}, {0x01000ddd, 0x575c08}, {0x000001a5, 0x576406}, {0x01001eb1, 0x576a0b},
+    {0x00000acc, 0x577510}, {0x01002078, 0x57850d}, {0x00000edb, 0x57920e}, {0x1008ff4e, 0x57a00b},
+    {0x1008fe08, 0x57ab0f}, {0x1008ff69, 0x57ba08}, {0x00000061, 0x57c201}, {0x1008ff5a, 0x57c307},
+    {0x000008ce, 0x57ca07}, {0x01000d8c, 0x57d107}, {0x000008a2, 0x57d80e}, {0x000006cc, 0x57e60b},
+    {0x00000aae, 0x57f108}, {0x0000ffca, 0x57f903}, {0x000006f5, 0x57fc0a}, {0x0100055c, 0x58060f},
+    {0x0100055a, 0x581513}, {0x00000aeb, 0x58280c}, {0x1004ff5a, 0x58340c}, {0x01002803, 0x58400f},
+    {0x0100284a, 0x584f10}, {0x01002872, 0x585f11}, {0x000006ef, 0x58700a}, {0x000000da, 0x587a06},
+    {0x0000fef4, 0x588011}, {0x00000ee1, 0x589114}, {0x0000fe07, 0x58a50e}, {0x0100067e, 0x58b30a},
+    {0x000004da, 0x58bd07}, {0x00000eb7, 0x58c40c}, {0x0000004b, 0x58d001}, {0x00000dda, 0x58d10c},
+    {0x01000655, 0x58dd12}, {0x000004b3, 0x58ef06}, {0x100812b1, 0x58f513}, {0x0000ff53, 0x590805},
+    {0x0000ffd0, 0x590d03}, {0x010004e9, 0x59100e}, {0x0000ffae, 0x591e0a}, {0x01002082, 0x59280c},
+    {0x010028c3, 0x593411}, {0x000006a1, 0x59450b}, {0x1008ff1a, 0x595009}, {0x1008ffb6, 0x59590f},
+    {0x01002862, 0x596810}, {0x1008ff04, 0x597811}, {0x01002876, 0x598912}, {0x000000e7, 0x599b08},
+    {0x0000fd0d, 0x59a309}, {0x0000004d, 0x59ac01}, {0x01001ea3, 0x59ad05}, {0x000006f8, 0x59b211},
+    {0x0000fef6, 0x59c30d}, {0x00000afa, 0x59d011}, {0x0000ffe9, 0x59e105}, {0x00000afd, 0x59e612},
+    {0x01000d9e, 0x59f808}, {0x1008ff80, 0x5a000c}, {0x010004b7, 0x5a0c16}, {0x010028a5, 0x5a2211},
+    {0x01002083, 0x5a330e}, {0x0000047e, 0x5a4108}, {0x000008b2, 0x5a4910}, {0x000004b0, 0x5a590e},
+    {0x000006da, 0x5a670b}, {0x00000dbe, 0x5a720c}, {0x1008ff39, 0x5a7e0f}, {0x0000ff94, 0x5a8d05},
+    {0x1004ff78, 0x5a920a}, {0x010028e0, 0x5a9c10}, {0x000008b4, 0x5aac19}, {0x1008ff36, 0x5ac508},
+    {0x0000fe08, 0x5acd0e}, {0x01000dc0, 0x5adb07}, {0x000000a4, 0x5ae208}, {0x01000561, 0x5aea0c},
+    {0x000006ae, 0x5af613}, {0x000008b3, 0x5b0919}, {0x000000aa, 0x5b220b}, {0x1008ff45, 0x5b2d0b},
+    {0x01001e85, 0x5b380a}, {0x010028cf, 0x5b4213}, {0x000006eb, 0x5b550b}, {0x010028ce, 0x5b6012},
+    {0x010028aa, 0x5b7211}, {0x000009e5, 0x5b8302}, {0x00000ab6, 0x5b8508}, {0x000000f6, 0x5b8d0a},
+    {0x1004ffff, 0x5b9709}, {0x000000ae, 0x5ba00a}, {0x000000a7, 0x5baa07}, {0x01001e57, 0x5bb109},
+    {0x1008ff99, 0x5bba13}, {0x1008ff27, 0x5bcd0b}, {0x000003b5, 0x5bd806}, {0x0000fd05, 0x5bde0c},
+    {0x01001eb9, 0x5bea09}, {0x01001ef2, 0x5bf306}, {0x0100287a, 0x5bf912}, {0x010001e6, 0x5c0b06},
+    {0x1004ff6a, 0x5c1107}, {0x000004cb, 0x5c1807}, {0x0100282d, 0x5c1f11}, {0x1008ff9d, 0x5c300d},
+    {0x00000cf7, 0x5c3d0b}, {0x010028d3, 0x5c4812}, {0x0000ff2c, 0x5c5a06}, {0x1008ff1c, 0x5c600f},
+    {0x00000056, 0x5c6f01}, {0x010028fd, 0x5c7014}, {0x000006b9, 0x5c840c}, {0x1004ff5d, 0x5c900c},
+    {0x000007ed, 0x5c9c08}, {0x000006e8, 0x5ca40b}, {0x0100281f, 0x5caf12}, {0x000000c4, 0x5cc10a},
+    {0x000007e9, 0x5ccb0a}, {0x0100049c, 0x5cd516}, {0x000006ba, 0x5ceb0c}, {0x000005d8, 0x5cf70a},
+    {0x01002858, 0x5d0110}, {0x01000d9b, 0x5d1108}, {0x000008bf, 0x5d1908}, {0x00000eb1, 0x5d210c},
+    {0x000000f9, 0x5d2d06}, {0x010001af, 0x5d3305}, {0x1008fe05, 0x5d380f}, {0x01002810, 0x5d470e},
+    {0x000008ae, 0x5d550e}, {0x000007b3, 0x5d630f}, {0x1008ff20, 0x5d720c}, {0x010028bb, 0x5d7e13},
+    {0x000001e6, 0x5d9106}, {0x0100285b, 0x5d9712}, {0x01000ddb, 0x5da908}, {0x010028d2, 0x5db111},
+    {0x01000583, 0x5dc20d}, {0x0000003d, 0x5dcf05}, {0x10081278, 0x5dd414}, {0x01001ee2, 0x5de80d},
+    {0x0000fe23, 0x5df513}, {0x0000006e, 0x5e0801}, {0x0000ffe2, 0x5e0907}, {0x1008ffa6, 0x5e1008},
+    {0x0000002b, 0x5e1804}, {0x01002896, 0x5e1c11}, {0x100812b9, 0x5e2d0f}, {0x01000551, 0x5e3c0c},
+    {0x01000688, 0x5e480b}, {0x000007b2, 0x5e5313}, {0x000000eb, 0x5e660a}, {0x010028d8, 0x5e7011},
+    {0x00000ce7, 0x5e810b}, {0x01000dd8, 0x5e8c08}, {0x01000492, 0x5e9410}, {0x00000ead, 0x5ea410},
+    {0x1008ff72, 0x5eb409}, {0x1004ff33, 0x5ebd0d}, {0x00000ed9, 0x5eca13}, {0x100811b9, 0x5edd12},
+    {0x000006e7, 0x5eef0c}, {0x1005ff7d, 0x5efb13}, {0x1008ff28, 0x5f0e08}, {0x1008ff07, 0x5f1616},
+    {0x1008ff40, 0x5f2c0b}, {0x00000aa9, 0x5f3706}, {0x00000bfc, 0x5f3d09}, {0x0000ffc1, 0x5f4602},
+    {0x010004ee, 0x5f4811}, {0x0000fef7, 0x5f590d}, {0x010028fe, 0x5f6614}, {0x010001d2, 0x5f7a06},
+    {0x00000aaf, 0x5f800f}, {0x0000ffe4, 0x5f8f09}, {0x000008af, 0x5f9814}, {0x0000ff3f, 0x5fac0e},
+    {0x01000db0, 0x5fba09}, {0x1008ff60, 0x5fc30a}, {0x1008ff81, 0x5fcd09}, {0x000001f0, 0x5fd607},
+    {0x010028dd, 0x5fdd13}, {0x01002806, 0x5ff00f}, {0x01001e56, 0x5fff09}, {0x1005ff00, 0x60080b},
+    {0x000004af, 0x601308}, {0x1008ffb5, 0x601b0a}, {0x00000eeb, 0x60250f}, {0x0100053f, 0x60340c},
+    {0x000007c3, 0x60400b}, {0x0000ff13, 0x604b05}, {0x0000feec, 0x60500f}, {0x010028a4, 0x605f10},
+    {0x00ffffff, 0x606f0a}, {0x01000dd0, 0x607908}, {0x10081209, 0x60810c}, {0x000007d6, 0x608d09},
+    {0x01002864, 0x609610}, {0x000000b3, 0x60a60d}, {0x010028d7, 0x60b313}, {0x0000ff1b, 0x60c606},
+    {0x1000ff73, 0x60cc0c}, {0x1004ff5e, 0x60d80c}, {0x00000dd0, 0x60e40a}, {0x00000029, 0x60ee0a},
+    {0x00000af4, 0x60f80b}, {0x00000abc, 0x610310}, {0x01002831, 0x611310}, {0x0100283d, 0x612312},
+    {0x0000fd03, 0x61350b}, {0x000001c5, 0x614006}, {0x000001f1, 0x614606}, {0x01001ed5, 0x614c0f},
+    {0x0000ffac, 0x615b0c}, {0x01000dae, 0x616709}, {0x010004b0, 0x617017}, {0x01001e8a, 0x618709},
+    {0x00000ce2, 0x61900c}, {0x000002d5, 0x619c09}, {0x00000ae0, 0x61a510}, {0x000000b7, 0x61b50e},
+    {0x10081274, 0x61c30a}, {0x0000007a, 0x61cd01}, {0x0000fd15, 0x61ce09}, {0x01002848, 0x61d70f},
+    {0x1008ff4f, 0x61e60b}, {0x000000ba, 0x61f109}, {0x010006f3, 0x61fa07}, {0x000007b4, 0x620110},
+    {0x00000afe, 0x621112}, {0x10081208, 0x62230c}, {0x01001ee4, 0x622f09}, {0x000005cc, 0x62380b},
+    {0x0100280e, 0x624310}, {0x1008ff85, 0x62530b}, {0x01002835, 0x625e11}, {0x010010f5, 0x626f0c},
+    {0x0000fe80, 0x627b06}, {0x000000d2, 0x628106}, {0x010028c9, 0x628711}, {0x1000ff6f, 0x62980b},
+    {0x0100284c, 0x62a310}, {0x01002247, 0x62b30b}, {0x1008ff66, 0x62be0a}, {0x00000aaa, 0x62c806},
+    {0x01002893, 0x62ce11}, {0x000003e7, 0x62df07}, {0x000006de, 0x62e60c}, {0x1004ff02, 0x62f207},
+    {0x0100285c, 0x62f911}, {0x00000de7, 0x630a0e}, {0x00000cdf, 0x631814}, {0x0000ff67, 0x632c04},
+    {0x00000024, 0x633006}, {0x0000ffdd, 0x633603}, {0x0000fee3, 0x63390c}, {0x0000ffd3, 0x634503},
+    {0x00000ebd, 0x63480d}, {0x00000eb3, 0x635511}, {0x01001ec4, 0x636610}, {0x010004b6, 0x637616},
+    {0x000007eb, 0x638c0b}, {0x010028ba, 0x639712}, {0x000006e5, 0x63a90b}, {0x010028bf, 0x63b414},
+    {0x00000ec4, 0x63c808}, {0x010028ed, 0x63d013}, {0x01001eaa, 0x63e310}, {0x01000dd9, 0x63f307},
+    {0x000004bc, 0x63fa08}, {0x01001ed3, 0x640210}, {0x01000dbb, 0x641207}, {0x10081177, 0x64190f},
+    {0x000009f8, 0x642807}, {0x010028d5, 0x642f12}, {0x0100289c, 0x644111}, {0x000008a7, 0x645210},
+    {0x000003b3, 0x646208}, {0x00000dd4, 0x646a0a}, {0x000006ed, 0x64740b}, {0x00000acd, 0x647f11},
+    {0x01000670, 0x649017}, {0x010028fb, 0x64a714}, {0x100000af, 0x64bb06}, {0x000003ba, 0x64c107},
+    {0x01000d9d, 0x64c808}, {0x00000eda, 0x64d00f}, {0x1008ff76, 0x64df0e}, {0x01002081, 0x64ed0c},
+    {0x0000fe04, 0x64f910}, {0x0000fd12, 0x650909}, {0x01000d83, 0x651207}, {0x1004ff60, 0x651909},
+    {0x01002849, 0x652210}, {0x000005f1, 0x65320d}, {0x0000fed0, 0x653f14}, {0x000001f8, 0x655306},
+    {0x010006a4, 0x65590a}, {0x01000556, 0x65630b}, {0x000005d7, 0x656e0a}, {0x00000ec8, 0x657809},
+    {0x000004de, 0x65810b}, {0x1008ff61, 0x658c0a}, {0x00000ef2, 0x65960e}, {0x0100057f, 0x65a40d},
+    {0x1008ff48, 0x65b10b}, {0x0000ffe6, 0x65bc0a}, {0x00000bca, 0x65c603}, {0x0000fe05, 0x65c90f},
+    {0x00000ab5, 0x65d80a}, {0x0100056e, 0x65e20c}, {0x00000de5, 0x65ee10}, {0x01000578, 0x65fe0b},
+    {0x000008df, 0x660909}, {0x01000dc5, 0x661208}, {0x00000db8, 0x661a0d}, {0x010010d9, 0x66270c},
+    {0x010006d2, 0x663310}, {0x00000023, 0x66430a}, {0x000004ba, 0x664d07}, {0x1008fe24, 0x665411},
+    {0x0100056a, 0x66650c}, {0x0000fff8, 0x66710d}, {0x00000de2, 0x667e0a}, {0x000007f5, 0x66880d},
+    {0x00000066, 0x669501}, {0x0000fe02, 0x669610}, {0x000001e3, 0x66a606}, {0x1005ff70, 0x66ac08},
+    {0x1004ff44, 0x66b40b}, {0x01000da9, 0x66bf08}, {0x10081268, 0x66c70a}, {0x000001a1, 0x66d107},
+    {0x00000db6, 0x66d80d}, {0x1008ff65, 0x66e50a}, {0x01000535, 0x66ef0d}, {0x1008ffa3, 0x66fc07},
+    {0x01002833, 0x670311}, {0x0100285a, 0x671411}, {0x0000fff4, 0x67250d}, {0x000004a9, 0x673206},
+    {0x000002f5, 0x673809}, {0x00000ec0, 0x674109}, {0x010028a0, 0x674a0f}, {0x0000ff56, 0x675904},
+    {0x00000ba9, 0x675d07}, {0x0000ffd9, 0x676403}, {0x0000fe25, 0x676716}, {0x10081188, 0x677d09},
+    {0x01000d82, 0x678607}, {0x01000d8e, 0x678d08}, {0x0000fd1b, 0x67950d}, {0x00000eb8, 0x67a20c},
+    {0x0000ffb6, 0x67ae04}, {0x01002884, 0x67b20f}, {0x0100056f, 0x67c10c}, {0x010010db, 0x67cd0c},
+    {0x000004cc, 0x67d907}, {0x01001eeb, 0x67e00a}, {0x10081215, 0x67ea10}, {0x000007f4, 0x67fa09},
+    {0x000001e0, 0x680306}, {0x00000058, 0x680901}, {0x000006cb, 0x680a0b}, {0x00000df1, 0x68150c},
+    {0x00000de3, 0x682112}, {0x01000323, 0x683312}, {0x000002fe, 0x68450b}, {0x01000547, 0x68500c},
+    {0x01002819, 0x685c10}, {0x10081207, 0x686c0c}, {0x00000cf9, 0x68780b}, {0x01001eb4, 0x68830b},
+    {0x0100283c, 0x688e11}, {0x00000059, 0x689f01}, {0x000001b3, 0x68a007}, {0x0000fd17, 0x68a70a},
+    {0x01001ec2, 0x68b10f}, {0x000002b6, 0x68c00b}, {0x0000fe67, 0x68cb0e}, {0x1008ff8f, 0x68d90a},
+    {0x0000ffad, 0x68e30b}, {0x000000e9, 0x68ee06}, {0x1008ff57, 0x68f408}, {0x10081263, 0x68fc1b},
+    {0x1008ff03, 0x691715}, {0x000006fb, 0x692c0c}, {0x000006c1, 0x69380a}, {0x0000fe5e, 0x694211},
+    {0x000004c7, 0x695307}, {0x000001db, 0x695a0c}, {0x0000002d, 0x696605}, {0x010028e3, 0x696b12},
+    {0x000000f0, 0x697d03}, {0x100812a2, 0x69800b}, {0x00000071, 0x698b01}, {0x00000ec2, 0x698c0a},
+    {0x0000fe2c, 0x699614}, {0x000004c4, 0x69aa07}, {0x000009ef, 0x69b10e}, {0x00000aa6, 0x69bf0a},
+    {0x00000ee5, 0x69c912}, {0x00000ce3, 0x69db0c}, {0x000004d1, 0x69e707}, {0x000006d0, 0x69ee0b},
+    {0x100000ab, 0x69f910}, {0x00000bd6, 0x6a0908}, {0x01000564, 0x6a110b}, {0x00000ce0, 0x6a1c0c},
+    {0x00000dad, 0x6a280b}, {0x000004bf, 0x6a3307}, {0x010010ef, 0x6a3a0d}, {0x01002899, 0x6a4711},
+    {0x1008ff8b, 0x6a580a}, {0x00000eef, 0x6a6217}, {0x000001ba, 0x6a7908}, {0x000000df, 0x6a8106},
+    {0x0000fe28, 0x6a8714}, {0x000002bb, 0x6a9b06}, {0x1008ff94, 0x6aa10d}, {0x100811d0, 0x6aae06},
+    {0x000006cd, 0x6ab40b}, {0x000001c0, 0x6abf06}, {0x00000da3, 0x6ac50d}, {0x0000ffc2, 0x6ad202},
+    {0x0100221a, 0x6ad40a}, {0x01002839, 0x6ade11}, {0x000006c2, 0x6aef0b}, {0x010020a4, 0x6afa08},
+    {0x01002815, 0x6b0210}, {0x00000cf2, 0x6b120b}, {0x0000ff62, 0x6b1d07}, {0x010006f0, 0x6b2407},
+    {0x1000ff70, 0x6b2b0c}, {0x000004b8, 0x6b3707}, {0x01002824, 0x6b3e0f}, {0x01000587, 0x6b4d14},
+    {0x1008129b, 0x6b610b}, {0x000003e0, 0x6b6c07}, {0x0100287f, 0x6b7314}, {0x0000ffda, 0x6b8703},
+    {0x01000db4, 0x6b8a07}, {0x000000e2, 0x6b910b}, {0x01000554, 0x6b9c0b}, {0x000002dd, 0x6ba706},
+    {0x01001eea, 0x6bad0a}, {0x000007e5, 0x6bb70d}, {0x01000538, 0x6bc40b}, {0x00000ac5, 0x6bcf0b},
+    {0x0100049d, 0x6bda16}, {0x000001ac, 0x6bf006}, {0x00000ae5, 0x6bf608}, {0x0000004c, 0x6bfe01},
+    {0x1008ffb4, 0x6bff08}, {0x01002208, 0x6c0709}, {0x000005cd, 0x6c100a}, {0x000007a7, 0x6c1a13},
+    {0x00000ea3, 0x6c2d11}, {0x000004d2, 0x6c3e07}, {0x0000fe85, 0x6c4506}, {0x000006dd, 0x6c4b0e},
+    {0x010010f4, 0x6c590c}, {0x10081272, 0x6c650f}, {0x01002886, 0x6c7410},
+};
+
+static const char keysym_name_pool[] =
+    "ATBRAILLE_DOTS_124578LBELOWDOTBRAILLE_DOTS_12378BRAILLE_DOTS_123456ARABI"
+    "C_TATWEELHANGUL_WAEF31XF86NEWUCIRCUMFLEXARMENIAN_TSOHORIZLINESCAN3KANA_H"
+    "OXF86FRAMEFORWARDCYRILLIC_HARDSIGNTHAI_CHOCHINGUOGONEKLUHORNACUTEXF86MAC"
+    "RO16ARMENIAN_SESCARONBRAILLE_DOTS_27BRAILLE_DOTS_345678HANGUL_HIEUHXF86B"
+    "RIGHTNESSMAXCYRILLIC_ENONESUPERIORXF86PREV_VMODEHPMUTE_ASCIICIRCUMXF86CA"
+    "MERALEFTNUMEROSIGNHPGUILDEROSFBEGINLINECOMBINING_GRAVEXF86LAUNCHDKP_F3BR"
+    "AILLE_DOTS_568COLONBRAILLE_DOTS_567DECIMALPOINTGREEK_RHOIBELOWDOTEISU_TO"
+    "GGLEDEAD_IXF86MACRO15GEORGIAN_SANXF86PASTEISO_PREV_GROUP_LOCKARABIC_HEH_"
+    "DOACHASHMEEISO_LAST_GROUP_LOCKBRAILLE_DOTS_1347SINH_MAARABIC_KEHEHARABIC"
+    "_HAMZAONWAWOSFCANCELGREEK_XISERBIAN_DJEBRAILLE_DOTS_13458THAI_RUKP_RIGHT"
+    "3270_ERASEINPUTF30CYRILLIC_SCHWAFFRANCSIGNPOINTER_DFLTBTNPREVCYRILLIC_SH"
+    "CHAHANGUL_CIEUCBRAILLE_DOTS_123568XF86KBDINPUTASSISTNEXTUHORNHOOKCUBEROO"
+    "TSUNVIDEOLOWERBRIGHTNESSGREEK_ALPHAEMPTYSETABELOWDOTBRAILLE_DOTS_1358XF8"
+    "6MYCOMPUTERABREVEGRAVEDCEDILLA_ACCENTHANGUL_PIEUBSIOSFIVESUBSCRIPTGEORGI"
+    "AN_CHAREIGHTSUBSCRIPTFINDXF86SUPPORTXF86SWITCH_VT_9SACUTEBACKSPACEBRAILL"
+    "E_DOTS_456ARABIC_KASRADEAD_ACYRILLIC_GHEHTBRAILLE_DOTS_2568UPRIGHTCORNER"
+    "HEBREW_FINALZADEGEORGIAN_GHANOSFUNDOGREEK_UPSILONXF86MUSICHANGUL_WISUNFA"
+    "_ACUTETHAI_KHOKHWAIBRAILLE_DOTS_234578HEBREW_ZADEKCEDILLAJBRAILLE_DOTS_1"
+    "2348CYRILLIC_EN_DESCENDERBRAILLE_DOTS_34567HANGUL_J_NIEUNBRAILLE_DOTS_14"
+    "8ARABIC_FULLSTOPBOTLEFTSQBRACKETTHAI_SARAAIMAIMALAIFILLEDTRIBULLETDOWNTH"
+    "ORNYBELOWDOTCYRILLIC_SHORTIOCIRCUMFLEXXF86NUMERIC5BRAILLE_DOTS_2467ARABI"
+    "C_HAMZAUNDERALEFIOCIRCUMFLEXACUTEXF86MACROPRESET3SUNCUTSCHWASINH_NDDADEA"
+    "D_BELOWBREVEXF86MARKETKP_DOWNHPINSERTCHARHANGUL_KKOGJIDALRINIEUNGHHANGUL"
+    "_ROMAJABRAILLE_DOTS_7CYRILLIC_PEKP_DELETECYRILLIC_KA_DESCENDERARMENIAN_J"
+    "EBRAILLE_DOT_1ARABIC_DALCYRILLIC_EKP_DIVIDEGREEK_EPSILONXF86SPELLXF86NEX"
+    "TFAVORITEGREEK_OMICRONYBELOWDOTCYRILLIC_ERXF86NUMERIC6IGRAVEDEGREESINH_A"
+    "UXF86AUDIODESCOBARREDACIRCUMFLEXDOWNXF86HOTLINKSXF86ROCKERUPXF86BRIGHTNE"
+    "SSAUTOHANGUL_J_KKOGJIDALRINIEUNGCOPYRIGHTSERBIAN_TSHEKANA_ITHAI_NGONGUMA"
+    "BOVEDOTCYRILLIC_SHHACYRILLIC_YERUSINH_TTATHEREFOREBRAILLE_DOTS_127XF86MA"
+    "CRO18THAI_BAHTBYELORUSSIAN_SHORTUBRAILLE_DOTS_56783270_ALTCURSORHORIZCON"
+    "NECTORDEAD_BREVECLUBXF86FINANCEBRAILLE_DOTS_13568BRAILLE_DOTS_123458DTIL"
+    "DEYDIAERESISGEORGIAN_FITHAI_TOTAODISO_PARTIAL_SPACE_RIGHTOSFPAGERIGHTACI"
+    "RCUMFLEXTILDEHANGUL_SSANGDIKEUDDOWNCARETMACEDONIA_DSESUNCOPYTOUROKUOHORN"
+    "BELOWDOTPOINTER_DOWNLEFTHEBREW_YODARMENIAN_SEPARATION_MARKHANGUL_RIEULMI"
+    "EUMXF86WORDBRAILLE_DOTS_4568XF86CAMERAUPCYRILLIC_ERXF86APPLICATIONRIGHTX"
+    "F86BRIGHTNESSADJUSTBRAILLE_DOTS_1234KANA_MACYRILLIC_CHEARABIC_JEHZXF86RO"
+    "TATEWINDOWSBRAILLE_DOTS_3478IMACRONARABIC_5HEBREW_FINALNUNXF86STANDBYARA"
+    "BIC_RAOCIRCUMFLEXTILDEHANGUL_J_KIYEOGSIOSISO_LAST_GROUPARMENIAN_ZAOSLASH"
+    "FARSI_YEHUNDERSCORETHAI_LUAACUTEMODE_SWITCHXF86MACRO7KANA_NBRAILLE_DOTS_"
+    "1BLANKCYRILLIC_EFXF86LEFTDOWNTHAI_DOCHADABRAILLE_DOTS_234567ARMENIAN_OBR"
+    "AILLE_DOTS_14567F34GEORGIAN_LASXF86SWITCH_VT_1ACIRCUMFLEXHOOKBRAILLE_DOT"
+    "S_2347HPMUTE_ASCIITILDETHAI_LEKHOKBRAILLE_DOT_7OACUTEDEAD_EEMOPENCIRCLEH"
+    "ANGUL_HANJAXF86OPENURLPOINTER_LEFTBXF86COMMUNITYIHOOKXF86MACRO10BRAILLE_"
+    "DOTS_12347GEORGIAN_CHIN3270_DUPLICATEHANGUL_WEOXF86MONBRIGHTNESSUPXF86MA"
+    "CRO11XF86SPLITSCREENCYRILLIC_IOECUSIGNHANGUL_RIEULPHIEUFXF86NUMERICDARME"
+    "NIAN_HOARMENIAN_VYUNXF86EXPLORERARMENIAN_RESABOVEDOTGEORGIAN_PARBRACKETL"
+    "EFTHANGUL_NIEUNJIEUJXF86YELLOWXF86MACRO4XF86KBDLCDMENU43270_ATTNARMENIAN"
+    "_KHEHANGUL_J_HIEUHBRAILLE_DOTS_124678HPMODELOCK1BRAILLE_DOTS_1234578CYRI"
+    "LLIC_BENCARONXF86MACRO17POINTER_ENABLEKEYSCONTROL_LWACUTEEMSPACEZEROSUPE"
+    "RIORSINH_O2CCARONARMENIAN_TCHEBRAILLE_DOTS_124XF86AUDIOFORWARDYENTHAI_SA"
+    "RAUEENTILDEARMENIAN_VYUNTOPTBRAILLE_DOTS_345GEORGIAN_DONSINH_KAACIRCUMFL"
+    "EXGRAVEMACRONSACUTENEWSHEQELSIGNMACEDONIA_GJEGREEK_PIISO_SET_MARGIN_LEFT"
+    "OSFBACKTABDEAD_CARONKANA_RIGREEK_GAMMAHANGUL_ENDAOGONEKBRAILLE_DOTS_125B"
+    "RAILLE_DOTS_45CHIRAGANA_KATAKANABRAILLE_DOTS_12358OCIRCUMFLEXBELOWDOTBRA"
+    "ILLE_DOTS_12357ARMENIAN_HIBRAILLE_DOTS_12346CYRILLIC_CHE_VERTSTROKEBRAIL"
+    "LE_DOT_9F25IMACRONBRAILLE_DOTS_15678GREEK_ALPHAXF86PHONESINH_NJA3270_QUI"
+    "TSINH_IIISO_FIRST_GROUPHEBREW_ZAINARABIC_NOON_GHUNNA3270_DELETEWORDABREV"
+    "ETILDEBRAILLE_DOTS_12367PREVIOUSCANDIDATEARABIC_ALEFMAKSURACYRILLIC_HA_D"
+    "ESCENDERUDIAERESISKANA_ABOTINTEGRALBRAILLE_DOTS_1367ECIRCUMFLEXBELOWDOTX"
+    "F86GRAPHICSEDITORF3HANGUL_JEONJAEHOOKDEAD_BELOWDOTXF86UNGRABBRACKETRIGHT"
+    "GREEK_OMEGAXF86CDOCIRCUMFLEXHOOKHIRAGANABRAILLE_DOTS_34568OHOOKXF86FAVOR"
+    "ITESGREEK_IOTAACCENTDIERESISIFONLYIFXF86MACRO29KANA_MILEFTTACKCYRILLIC_I"
+    "_MACRONHANGUL_J_NIEUNJIEUJEXT16BIT_RSUNFA_CIRCUMTHAI_CHOCHANSINH_SADEAD_"
+    "UBREAKC_HZENKAKUKANA_EGEORGIAN_SHINUKRAINIAN_IINCLUDEDINKANA_RAXF86GREEN"
+    "BRAILLE_DOTS_35678THAI_SARAAETHAI_KHOKHONLSTROKEBRAILLE_DOTS_24578BRAILL"
+    "E_DOTS_134568OPENRECTBULLETAPPROXIMATEBRAILLE_DOTS_2POINTER_BUTTON3XF86D"
+    "ATABASEISO_ENTERDSTROKETHAI_NIKHAHITABREVEHOOKKANA_KEHANGUL_J_MIEUMXF86S"
+    "WITCH_VT_7OSFCLEARRCEDILLAZABOVEDOTTHAI_THANTHAKHATEMACRONOSFPAGELEFTNOT"
+    "EQUALCYRILLIC_HASUACUTEDEAD_BELOWCIRCUMFLEXDEAD_CAPITAL_SCHWAARABIC_SADG"
+    "REEK_MUISO_FAST_CURSOR_UPLEFTTBRAILLE_DOTS_13POINTER_RIGHTBRAILLE_DOTS_1"
+    "2456CYRILLIC_TEFABOVEDOTXF86SUSPENDHYPER_RHANGUL_OHPLONGMINUSCAREOFOSFAD"
+    "DMODEAHOOKMILLSIGNDEAD_BELOWDIAERESISZCARONNEXT_VIRTUAL_SCREENJCIRCUMFLE"
+    "XARMENIAN_SEXF86DISPLAYTOGGLEBRAILLE_DOTS_124567SIXSUPERIORBOTRIGHTSQBRA"
+    "CKETARABIC_PERCENTSEVENSUBSCRIPTXF86CAMERADOWNSINH_UTHAI_FOFANGREEK_IOTA"
+    "DIERESIS3270_RULEBRAILLE_DOTS_1578BRAILLE_DOTS_467HANGUL_KHIEUQZACUTEOTI"
+    "LDEHPMUTE_ACUTESINH_LUHANGUL_KIYEOGARMENIAN_TSAHPRESETBRACELEFTXF86VOICE"
+    "MAILBRAILLE_DOTS_248ARMENIAN_GHATBRAILLE_DOTS_1247AACUTESINH_EEHORIZLINE"
+    "SCAN9NBACKSLASHIGRAVEOCARONOARABIC_4XF86AUDIOREWINDSINH_AEBRAILLE_DOT_10"
+    "BRAILLE_DOTS_135679MUARABIC_LAMHANGUL_SUNKYEONGEUMMIEUMXF86MACRO6SUNF37I"
+    "TILDEBRAILLE_DOTS_278HPMUTE_GRAVEHANGUL_EOGREEK_OMICRONACCENTEXT16BIT_LS"
+    "INH_KUNDDALIYAKANA_KIHANGUL_UHANGUL_DIKEUDKANA_COMMACOMBINING_ACUTEXF86A"
+    "LSTOGGLERCARONWGRAVE3270_IDENTKOREAN_WONSECONDSXF86BATTERYYDIAERESISLEFT"
+    "DOUBLEQUOTEMARKDOWNTACKXF86TIMETSUNPOWERSWITCHHANGUL_PREHANJAXF86FN_ESCB"
+    "RAILLE_DOT_6CYRILLIC_EDEAD_ABOVEVERTICALLINEDOWNSTILEOHOOKBRAILLE_DOTS_5"
+    "7BRAILLE_DOTS_13678BRAILLE_DOTS_12368CABOVEDOTTHAI_SARAAMKBRAILLE_DOTS_1"
+    "35678HYPHENDEAD_UHSEMIVOICEDSOUNDCYRILLIC_ELFEMALESYMBOLXF86LAUNCH7DEAD_"
+    "IOTA3270_RECORDIBREVEARABIC_SEENIACUTEARMENIAN_MENSINH_TTHACYRILLIC_IDEA"
+    "D_EBRAILLE_DOTS_246BRAILLE_DOTS_25678RUPEESIGNGEORGIAN_WEXF86TASKPANESIN"
+    "H_AA2BRAILLE_DOTS_1235678OSFENDDATAF20KANA_WOBRAILLE_DOTS_1467THAI_SORUS"
+    "IARABIC_GAFYCIRCUMFLEXDEAD_CIRCUMFLEXXABOVEDOTHANGUL_RIEULPIEUBGEORGIAN_"
+    "ANCYRILLIC_YUXF86LAUNCHBACCESSX_FEEDBACK_ENABLEOCIRCUMFLEXGRAVEPOINTER_D"
+    "BLCLICK2BRAILLE_DOTS_1246OCIRCUMFLEXOHORNTILDETHAI_LEKSAMMETA_RTHAI_LEKS"
+    "UNGREEK_ETABRAILLE_DOTS_1238F18HEBREW_HEXF86SENDKP_HOMEGXF86MEMOARABIC_T"
+    "CHEHINFINITYADIAERESISPOINTER_DBLCLICK3ARMENIAN_TOGEORGIAN_INDEAD_DOUBLE"
+    "ACUTEBRAILLE_DOTS_123XF86LIGHTSTOGGLEGBREVETOPINTEGRALFILLEDLEFTTRIBULLE"
+    "TTHAI_PHOSAMPHAOECIRCUMFLEXACUTECYRILLIC_ZHEARABIC_QUESTION_MARKXF86STOP"
+    "RECORDKANA_YURARMENIAN_ZHEGREEK_UPSILONDIERESISCABOVEDOTARMENIAN_BENHANG"
+    "UL_YAECIRCUMFLEXGRAVEOGRAVEDIAMONDUPINSERTCYRILLIC_YUKANA_ROHANGUL_TIEUT"
+    "UKRAINIAN_GHE_WITH_UPTURN3270_LEFT2GREEK_LAMDADEAD_SMALL_SCHWAC_HHEBREW_"
+    "FINALMEMGREEK_OMEGATHAI_SARAIIRIGHTSINGLEQUOTEMARKKANJIBREVEXF86KEYBOARD"
+    "OSFPAGEUPISO_CENTER_OBJECTF27UTILDEBRAILLE_DOTS_23457LINEFEEDBRAILLE_DOT"
+    "S_12478CYRILLIC_U_STRAIGHTXF86ZOOMRESETBRAILLE_DOTS_178BRAILLE_DOTS_2367"
+    "8XF86INFOBRAILLE_DOTS_1567BRAILLE_DOTS_23568ECIRCUMFLEXGEORGIAN_XANDEAD_"
+    "ABOVEREVERSEDCOMMA0MOUSEKEYS_ACCEL_ENABLEBRAILLE_DOTS_128ZCARONKANA_SAOS"
+    "FMENUGEORGIAN_CANXF86VIDEOPHONEPOINTER_UPRIGHTIABOVEDOTEXCLAMDOWNXF86SLE"
+    "EPXF86SWITCH_VT_2CYRILLIC_ESXF86MACRO24XF86SWITCH_VT_11ARABIC_MADDAONALE"
+    "FBABOVEDOTHEBREW_MEMARMENIAN_EUKRAINIAN_GHE_WITH_UPTURNXF86SCREENSAVERBO"
+    "TLEFTPARENSISO_CONTINUOUS_UNDERLINENOTSIGNTHAI_PHOPHUNGXF86MACROPRESET1X"
+    "F86TRAVEL2IDENTICALTHAI_HONOKHUKGUILLEMOTRIGHTMABOVEDOTSINH_LUU2F14DEAD_"
+    "OGONEK3270_PA3PARABIC_BEHGREEK_PHIHANGUL_SSANGKIYEOGROMAJIPOINTER_DRAG1U"
+    "HOOKNOBREAKSPACETOPRIGHTPARENSBRAILLE_DOTS_1257SUPER_LHEBREW_NUNXF86NUME"
+    "RIC0ABREVEACUTEUDIAERESISABREVEHOOKAESUNAUDIORAISEVOLUMEARMENIAN_DZABRAI"
+    "LLE_DOTS_58FBRAILLE_DOTS_13468YACUTEKANA_OARABIC_8FOURSUPERIORESINH_THAC"
+    "YRILLIC_ZHE_DESCENDERBRAILLE_DOTS_37ATILDEGREATERTHANEQUALBRAILLE_DOTS_2"
+    "4678ARMENIAN_TCHEOSFPASTEXF86ATTENDANTONBRAILLE_DOTS_3678CYRILLIC_GHE_BA"
+    "RHANGUL_RIEULNACUTEXF86SWITCH_VT_12CYRILLIC_JECYRILLIC_ENGREEK_MUBRAILLE"
+    "_DOTS_134XF86HOMEPAGEKP_TABTHAI_THOTHANONEEIGHTHSELECTBRAILLE_DOTS_3578E"
+    "MFILLEDRECTGEORGIAN_ONABREVEBELOWDOTTSLASH3CHSUNVIDEORAISEBRIGHTNESS1ARA"
+    "BIC_7ISO_RELEASE_BOTH_MARGINSBRAILLE_DOTS_1248IACUTEOSFDESELECTALLXF86CA"
+    "MERAZOOMOUTOSFMENUBARTHAI_SARAUEUNDERBARDIGITSPACEDEAD_BELOWVERTICALLINE"
+    "KP_0HANGUL_OEXF86SCROLLDOWNEHOOKBRAILLE_DOTS_34578THAI_PAIYANNOIETILDEKA"
+    "TAKANATHAI_LOLINGXF86HISTORYEBELOWDOTKANA_HENLTHREEFIFTHSSUNAUDIOLOWERVO"
+    "LUMEKANA_CLOSINGBRACKETIHOOKOETOPRIGHTSQBRACKETSINH_RUU23270_ENTERXF86VO"
+    "DISO_EMPHASIZEXF86WPSBUTTONGREEK_CHIBRAILLE_DOTS_12567ECIRCUMFLEXACUTEDE"
+    "AD_DOUBLEGRAVEIBELOWDOTPERCENTHPUSERARABIC_HAMZACYRILLIC_IEGREEK_OMEGAAC"
+    "CENTAMPERSANDGREEK_HORIZBARETILDEKP_7OBELOWDOT3270_PA2XF86AUDIOMUTETHAI_"
+    "POPLABRAILLE_DOTS_2478ARABIC_WAW6STRICTEQXF86MEETINGBRAILLE_DOTS_356ARAB"
+    "IC_MADDA_ABOVEARABIC_ZAINXF86NUMERIC2XF86WAKEUPPERIODKANA_YOARABIC_KHAHX"
+    "F86SWITCH_VT_10DEAD_BELOWTILDECYRILLIC_U_STRAIGHTIBREVEXF86CONTEXTMENUXF"
+    "86POWEROFFF1MUSICALFLATGRAVEKP_2HANGUL_YEOPOINTER_DBLCLICK5XF86AUDIOPAUS"
+    "EHEBREW_BETYACUTEISO_NEXT_GROUP_LOCKBOTRIGHTSUMMATIONIDIAERESISXF86MACRO"
+    "20CIRCLEBRAILLE_DOT_2POINTER_BUTTON_DFLTBRAILLE_DOTS_16ARABIC_TTEHARMENI"
+    "AN_TYUNBRAILLE_DOTS_123678GEORGIAN_ZHAROSFNEXTMENUXF86VOICECOMMANDDEAD_A"
+    "BOVEDOTCGREATERTINTEGRALMUHENKANHCIRCUMFLEXKANA_NIMACEDONIA_KJELEFTPOINT"
+    "EROSFSELECTALLKP_4DEAD_OCENTXF86EMOJIPICKERBOPENTRIBULLETUPECIRCUMFLEXGR"
+    "AVECYRILLIC_TSEBRAILLE_DOTS_2346ISO_LEVEL5_LOCKHANGUL_PIEUBXF86MACRO2CYR"
+    "ILLIC_EN_DESCENDERIDIAERESISTHAI_FOFASINH_RIGREEK_UPSILONACCENTBRAILLE_D"
+    "OTS_1234678ARMENIAN_HYPHENKANA_EF7SIGNATUREMARKECIRCUMFLEXCYRILLIC_JESIN"
+    "H_DHAUHORNHOOKKANA_WAUHORNBELOWDOTPOINTER_UPLAST_VIRTUAL_SCREENBRAILLE_D"
+    "OTS_14678ARMENIAN_PYUR3270_CURSORBLINKUMACRONXF86MEDIATOPMENUAUDIBLEBELL"
+    "_ENABLEARABIC_DAMMAARABIC_YEHGEORGIAN_GANEOGONEKCHECKERBOARDTHAI_SARAEHA"
+    "NGUL_ARAEAEHANGUL_J_RIEULKIYEOGTWOFIFTHSISO_MOVE_LINE_DOWNPARENLEFTDEAD_"
+    "CEDILLAHANGUL_RIEULHIEUHSINH_LAKANA_TAHEXAGRAMKP_UPOECYRILLIC_ABARAGRAVE"
+    "KANA_MOBRAILLE_DOTS_13457OSFPAGEDOWNDEAD_ABOVECOMMASINH_JHAXF86SCROLLUPA"
+    "CIRCUMFLEXGRAVEARMENIAN_LYUNARMENIAN_INIDEAD_MACRONXF86SPELLCHECKBRAILLE"
+    "_DOTS_46THAI_TOPATAKBRAILLE_DOTS_17BRAILLE_DOTS_12467THAI_BOBAIMAIENDSOL"
+    "IDDIAMONDXF86ROCKERENTERARABIC_DADXF86MACRO13XF86MACRO26ASCIITILDEDACUTE"
+    "_ACCENTOCIRCUMFLEXACUTEXF86BACKTHAI_RORUASTICKYKEYS_ENABLEDEAD_ACUTECOMM"
+    "ASINH_OOEGRAVEBRAILLE_DOTS_2357SINH_AIINCLUDESGREEK_ALPHAACCENTBRACERIGH"
+    "TMOUSEKEYS_ENABLEOTILDEDEAD_SEMIVOICED_SOUNDLEFTSINGLEQUOTEMARKLOWRIGHTC"
+    "ORNERSINH_AEE2OGONEKMINUTESARMENIAN_LYUNEMFILLEDCIRCLEHANGUL_SUNKYEONGEU"
+    "MPHIEUFXF86HIBERNATEAMACRONRXF86BACKFORWARDISO_PARTIAL_LINE_DOWNKRAOHORN"
+    "HOOKFUNCTIONDIVISIONARABIC_6UTILDEOSFRESELECTXF86PRIVACYSCREENTOGGLEGREE"
+    "K_NUOSFCUTPOINTER_BUTTON1CYRILLIC_ZHE_DESCENDERXF86AUDIOPREVXF86FASTREVE"
+    "RSECYRILLIC_SHHAXF86BOOKZABOVEDOTEM4SPACESIMILAREQUALXF86LOGGRABINFOXF86"
+    "OFFICEHOMEPRINTSINH_AAOHORNACUTEXF86SUBTITLEHANGUL_STARTABELOWDOTNCEDILL"
+    "AXF86XFERXF86SAVETCEDILLAHANGUL_J_RIEULSIOSXF86LAUNCH4SINH_OHEBREW_KAPHB"
+    "RAILLE_DOTS_12458FIVESUPERIORXF86APPSELECTQUESTIONLESSLEFTRADICALBRAILLE"
+    "_DOTS_18EOGONEKCHNCARONF26REPEATKEYS_ENABLESCEDILLAXF86PICKUPPHONEARABIC"
+    "_KAFSUNPASTEGEORGIAN_BANBRAILLE_DOTS_1345DEAD_HOOKPOINTER_DBLCLICK4THAI_"
+    "THONANGMONTHOSUNF36OVERBARARABIC_TEHMARBUTAXGREEK_XIXF86SWITCH_VT_4GREEK"
+    "_PSIFABOVEDOTF35ARINGCYRILLIC_SHORTIYCIRCUMFLEXEISU_SHIFTXF86AUDIOLOWERV"
+    "OLUMEACCESSX_ENABLECYRILLIC_NJEXF86ADDRESSBOOKEZHARABIC_RREHOSLASHOSFLEF"
+    "TOACUTEXF86GOTHAI_SARAAAARABIC_HA3270_PRINTSCREENXF86CLEARXF86USER2KBBRA"
+    "ILLE_DOTS_357XF86CLOSEXF86APPLICATIONLEFTCYRILLIC_TEBRAILLE_DOTS_235HANG"
+    "UL_ARAEABRAILLE_DOTS_4CYRILLIC_VEZSTROKEKANA_YANINESUBSCRIPTBRAILLE_DOTS"
+    "_245SINH_AKP_SPACEHEBREW_RESHSINH_LUUTHINSPACEDEAD_LONGSOLIDUSOVERLAYARA"
+    "BIC_NOONXF86KBDBRIGHTNESSDOWNGEORGIAN_VINXF86NOTIFICATIONCENTERZENKAKU_H"
+    "ANKAKUCARETKP_8SEVENEIGHTHSCYRILLIC_LJEDECIRCUMFLEXHOOKMALESYMBOLDEAD_BE"
+    "LOWMACRONXF86RIGHTUPCYRILLIC_YAABOVEDOTWCIRCUMFLEXXF86VENDORHOMEKP_3XF86"
+    "POWERDOWNDEAD_CURRENCYBRAILLE_DOTS_3GCEDILLAARMENIAN_OARABIC_SEMICOLONAR"
+    "MENIAN_GIMHANGULXF86AWAYLACUTELCEDILLABRAILLE_DOTS_1378UGRAVEKANA_NOHANG"
+    "UL_J_RIEULTIEUTF21HANGUL_SSANGJIEUJXF86WHEELBUTTONXF86KBDLCDMENU5OMACRON"
+    "UHOOKTHAI_LEKPAETHEBREW_FINALKAPHCYRILLIC_ZHEGREEK_RHOUPLEFTCORNERXF86CA"
+    "LCULATERTHAI_WOWAENECARONISO_LOCKUNIONONEHALFCYRILLIC_U_STRAIGHT_BARCOMB"
+    "INING_HOOKHANKAKURIGHTMIDDLESUMMATIONSINH_IXF86NEXT_VMODEXF86BUTTONCONFI"
+    "GXF86AUDIOMEDIAGEORGIAN_HEBRAILLE_DOTS_123567BRAILLE_DOTS_12468URINGJHAN"
+    "GUL_YIBABOVEDOTBRAILLE_DOTS_1237BRAILLE_DOTS_6EUROSIGNHANGUL_JAMOGREEK_T"
+    "HETAARMENIAN_AYBCRXF86PICTURESLEFTDOUBLEACUTETHREEEIGHTHSHEBREW_WAWBRAIL"
+    "LE_DOTS_56BEGINXF86LAUNCH9BRAILLE_DOTS_1268BRAILLE_BLANKHANGUL_WEEABOVED"
+    "OTCEDILLAHEBREW_PEPOINTER_DRAG4ABREVEACUTEXF86TODOLISTCCEDILLAIDOTLESSSI"
+    "NH_BHABRAILLE_DOTS_26KP_ENDMACEDONIA_KJETHAI_SOSUAARMENIAN_VOBECAUSEOVER"
+    "LAY1_ENABLEUHORNTILDEUDOUBLEACUTEUBELOWDOTXF86CALCULATOR3270_KEYCLICKENS"
+    "PACEMACEDONIA_DSEARMENIAN_VEVEABOVEDOTBRAILLE_DOTS_3568ONEQUARTERALT_RPO"
+    "INTER_ACCELERATEMACEDONIA_GJEHANGUL_YEORINHIEUHARABIC_9ARMENIAN_GIMYHOOK"
+    "SINH_I2POINTER_DBLCLICK_DFLTGREEK_ZETAXF86MACRO27OSFRIGHTSINH_EE2OSFESCA"
+    "PEFARSI_2DEAD_HORNVARIATIONSINH_SSHASINH_NDHABRAILLE_DOTS_136CONTAINSASB"
+    "RAILLE_DOTS_14NTILDEARMENIAN_ATXF86LAUNCHCKANA_NEENGTRADEMARKINCIRCLETHA"
+    "I_SARAUARABIC_QAFBRAILLE_DOTS_145678SCROLL_LOCKXF86LAUNCH3GREEK_CHIBRAIL"
+    "LE_DOTS_25YTILDEITHAI_YOYAKCACUTEUKRAINIAN_IEBRAILLE_DOTS_1236UOGONEKXF8"
+    "6SWITCH_VT_6GEORGIAN_ZEN3270_PA1HSTROKESTERLINGXF86ATTENDANTOFFHPSYSTEMB"
+    "RAILLE_DOTS_234683270_CHANGESCREENARABIC_HAMZA_ABOVEC_HTCARONXF86JOURNAL"
+    "GREEK_UPSILONACCENTDIERESISGREEK_THETAOVERLAY2_ENABLETABOVEDOTDCARONTOPR"
+    "IGHTSUMMATIONGREEK_SIGMATOPLEFTSUMMATIONCYRILLIC_KA_DESCENDERGEORGIAN_PH"
+    "ARGCIRCUMFLEXSUNFRONTCCIRCUMFLEXFARSI_7XF86WLANTHAI_MAICHATTAWAHAIRSPACE"
+    "OSFPRIMARYPASTEARMENIAN_GHATTHAI_NONUKP_PRIORLCEDILLACYRILLIC_HA_DESCEND"
+    "ERHEBREW_TETGREEK_BETAKANA_LOCKXF86LAUNCH6ARMENIAN_RAARMENIAN_ACCENTCCIR"
+    "CUMFLEXGREEK_KAPPACYRILLIC_SCHWABRAILLE_DOTS_268PREV_VIRTUAL_SCREENXF863"
+    "DMODEWONSIGNTHAI_MAIHANAKATENOPENSQUAREBULLETCYRILLIC_EFGEORGIAN_JILXF86"
+    "AUDIOCYCLETRACKBOUNCEKEYS_ENABLEGEORGIAN_TANKP_F1UHORNACUTEEACUTECYRILLI"
+    "C_DEARMENIAN_NUPRESCRIPTIONKANA_IXF86ROTATIONLOCKTOGGLEKANA_SEPLUSMINUSA"
+    "RABIC_0CYRILLIC_IXF86SLOWREVERSEXF86KBDINPUTASSISTPREVEDIAERESISXF86EXCE"
+    "LBRAILLE_DOTS_2367CHECKMARKATILDERIGHTANGLEBRACKETDEAD_LOWLINEBRAILLE_DO"
+    "TS_24ARMENIAN_CHAICIRCUMFLEXEGREEK_IOTASINGLECANDIDATEUPSHOEARMENIAN_VEV"
+    "BRAILLE_DOTS_458DIAERESISOSFDOWNXF86MACRO30CYRILLIC_VEGREEK_IOTAACCENTDO"
+    "WNARROWISO_FIRST_GROUP_LOCKKANA_SHIFTUARABIC_SUKUNTHAI_LOCHULAHANGUL_J_Y"
+    "EORINHIEUHHORIZLINESCAN5ARABIC_3XF86SELECTIVESCREENSHOTISO_GROUP_LATCHFI"
+    "LLEDTRIBULLETUPBRAILLE_DOTS_4678ARMENIAN_PEXF86MACRO9XF86CYCLEANGLEBRAIL"
+    "LE_DOTS_257ARMENIAN_JEOCIRCUMFLEXTILDEPOINTER_DBLCLICK1HORIZLINESCAN7SIN"
+    "H_MBAXF86SELECTXF86REFRESHINTERSECTIONKP_MULTIPLYKP_1ARMENIAN_KHETHAI_MA"
+    "IYAMOKBRAILLE_DOTS_2348SINH_HABRAILLE_DOTS_15TCEDILLAAPOINTER_BUTTON2SIN"
+    "H_AEESINH_CHAHANGUL_J_RIEULMIEUMCYRILLIC_U_MACRONUPTACKARMENIAN_HOCYRILL"
+    "IC_IOBRAILLE_DOTS_1678HENKAN_MODESINH_SHASINH_LU2BRAILLE_DOTS_126THAI_DO"
+    "DEKHOMEOSFUPXF86ROTATIONPBTWOSUPERIORSINH_CAOSFBACKSPACEBRAILLE_DOTS_48B"
+    "RAILLE_DOTS_13478RIGHTDOUBLEQUOTEMARKYTILDEHANGUL_J_TIEUTKP_ADDDABOVEDOT"
+    "APOSTROPHEGEORGIAN_NARGCIRCUMFLEXBRAILLE_DOTS_123467XF86ROOTMENUTHAI_OAN"
+    "GBRAILLE_DOTS_236MALTESECROSSARMENIAN_CHAXF86CAMERARIGHTENGYHOOKCYRILLIC"
+    "_ES3270_FIELDMARKOSFINSERTXF86OPENDINTEGRALTHAI_MAIHANAKAT_MAITHOTHAI_LE"
+    "KCHETCODEINPUTHANGUL_J_RIEULHIEUHISO_PREV_GROUPXF86MACRO22FARSI_8XF86NUM"
+    "ERICBTELEPHONEXF86MYSITESHANGUL_J_SSANGSIOSXF86TOPMENUXF86MACRO14BRAILLE"
+    "_DOTS_146XF86MACRO5XF86NUMERIC1XF86SCREENSAVERBRAILLE_DOTS_23458QUESTION"
+    "DOWNBRAILLE_DOTS_1468IOGONEKAGRAVEEGRAVEGREEK_DELTAGUILLEMOTLEFTBRAILLE_"
+    "DOTS_167XF86KBDINPUTASSISTCANCELBRAILLE_DOTS_134567DONGSIGNDEAD_GREEKPOI"
+    "NTER_DRAG5UPARROWGEORGIAN_HAEPOINTER_DOWNRIGHTXF86LAUNCHAF23SINH_II2WVTD"
+    "EAD_STROKEHANGUL_J_RIEULPIEUBBRAILLE_DOTS_468GREEK_EPSILONACCENTARABIC_H"
+    "AMZAONALEFOHORNTILDE8XF86DISPLAYXF86NUMERIC113270_RESETGREEK_PIFARSI_1FA"
+    "RSI_6HANGUL_SSANGSIOSARMENIAN_DZASIGNIFBLANKBRAILLE_DOTS_14568ARMENIAN_R"
+    "EOSFPREVMENUF6THAI_HOHIPZEROSUBSCRIPTNOTELEMENTOFCYRILLIC_DZHEGEORGIAN_H"
+    "IEDEAD_BELOWCOMMAACIRCUMFLEXBELOWDOTXF86UWBHANGUL_SUNKYEONGEUMPIEUBCYRIL"
+    "LIC_OCOMBINING_TILDEXF86GAMECYRILLIC_I_MACRONBRAILLE_DOTS_245678XF86CAME"
+    "RAFOCUSARABIC_THEHGEORGIAN_UNSINH_JAHANGUL_J_SSANGKIYEOGKANA_YOTCARONXF8"
+    "6DICTATEXF86CUTARABIC_MEEMBRAILLE_DOTS_1245XF86KBDLCDMENU3LEFTCARETPOINT"
+    "ER_BUTTON5UMACRONBRAILLE_DOTS_1357SUNFA_DIAERESISXF86LAUNCH2PESETASIGNGC"
+    "EDILLAWDIAERESISBRAILLE_DOTS_23456SINH_NADGRAVE_ACCENTKANA_AECIRCUMFLEXB"
+    "ELOWDOTABREVEBELOWDOTTRADEMARKSUNAUDIOMUTECYRILLIC_SHATHAI_KOKAIFARSI_4H"
+    "ANGUL_J_PANSIOSGREEK_FINALSMALLSIGMAGREEK_BETAHEBREW_LAMEDSINH_GAMULTI_K"
+    "EYISO_FAST_CURSOR_RIGHTSCHWADREMOVEDABOVEDOTF15SUNVIDEODEGAUSSBRAILLE_DO"
+    "TS_3468XF86NUMERIC12GREEK_PSIBRAILLE_DOTS_4567DEAD_INVERTEDBREVEABREVEGB"
+    "RAILLE_DOTS_1267BRAILLE_DOTS_2678THAI_MAITHOSINH_ESUNOPENFOURTHROOTXF86A"
+    "TTENDANTTOGGLEACIRCUMFLEXACUTEBRAILLE_DOTS_67BRAILLE_DOTS_34KANA_CONJUNC"
+    "TIVEGREEK_KAPPAXF86AUDIOSTOPTERMINATE_SERVERF8ISO_LEVEL5_LATCHGREEK_ACCE"
+    "NTDIERESIS5HANGUL_NIEUNHIEUHRIGHTMIDDLECURLYBRACEEZHHANGUL_J_CIEUCRIGHTS"
+    "HOEARMENIAN_MENRIGHTARROWXF86AUDIOREPEATBRAILLE_DOTS_34678BRAILLE_DOTS_3"
+    "46UKRAINIAN_IEXF86NUMERICCGCARONHANGUL_J_PHIEUFISO_MOVE_LINE_UPHANGUL_J_"
+    "PIEUBCANCELVERTCONNECTORTHORNXF86IMAGESMVGREEK_ALPHAACCENTSINH_NGAGREEK_"
+    "OMICRONXF86NUMERIC3XF86OPTIONXF86KBDBRIGHTNESSUPKANA_OCLEARASCIICIRCUMHP"
+    "KP_BACKTABLCARONSINH_FARADICALMETA_LHPDELETELINEARMENIAN_TOFARSI_9THAI_N"
+    "ONENTHREEQUARTERSBRAILLE_DOTS_378BRAILLE_DOTS_348ASTERISKXF86QPHONOGRAPH"
+    "COPYRIGHTSCIRCUMFLEXLOGICALANDARMENIAN_PEQHPMODELOCK2ARMENIAN_FULL_STOPO"
+    "NEFIFTHBRAILLE_DOTS_2368KANA_YUXF86MACRO1XF86TOUCHPADONDDIAERESISISO_REL"
+    "EASE_MARGIN_RIGHTCYRILLIC_DEARABIC_FATHATANXF86NUMERIC4BRAILLE_DOTS_1234"
+    "57LEFTSHOEOBELOWDOTGEORGIAN_KHARDCIRCUMFLEX_ACCENTAPPROXEQUHORNDEAD_TILD"
+    "E7HPBLOCKKANA_NAXF86DVDUPSTILEXF86NUMERICPOUNDEXCLAMCYRILLIC_DZHECARONKA"
+    "NA_TEPOINTER_UPLEFTJCIRCUMFLEXBRAILLE_DOTS_123468GREEK_DELTAKANA_RUEMOPE"
+    "NRECTANGLE3270_CURSORSELECTGREEK_IOTADIERESISSINH_JNYAISO_RELEASE_MARGIN"
+    "_LEFTARABIC_SHEENSIXSUBSCRIPTTHAI_THOPHUTHAOCRUZEIROSIGNKANA_OPENINGBRAC"
+    "KETOHORNSCARONXF8610CHANNELSUPARMENIAN_NUDRING_ACCENTSHIFT_LLBELOWDOTXF8"
+    "6USERPBHANGUL_J_IEUNGKP_INSERTNINESUPERIORHANGUL_BANJABRAILLE_DOTS_45678"
+    "LEFTARROWXF86AUDIORAISEVOLUMETHAI_MOMAHANGUL_J_SIOSICIRCUMFLEXENFILLEDSQ"
+    "BULLETCYRILLIC_HARDSIGNXF86CONTROLPANELGEORGIAN_QARBRAILLE_DOTS_258KP_9I"
+    "SO_LEVEL5_SHIFTKP_BEGINXF86MACRO8KP_ENTERMULTIPLYHYPER_LARMENIAN_HIOHORN"
+    "GRAVEBRAILLE_DOTS_23578XF86ASSISTANTCYRILLIC_CHE_VERTSTROKEWGRAVESPACEWC"
+    "IRCUMFLEXBRAILLE_DOTS_14578SINH_BAXF86AUDIOMICMUTETHAI_SARAUUARABIC_TEH3"
+    "270_ERASEEOFTHAI_SOSALACYRILLIC_TSEXF86CLEARGRABXF86EJECTPERMILLELESSTHA"
+    "NEQUALKANA_TSUXF86NUMERICSTAROHORNGRAVEXF86ZOOMOUTXF86ROCKERDOWNXF86SCRO"
+    "LLCLICKPOINTER_DFLTBTNNEXTBRAILLE_DOTS_478KANA_FULLSTOPPARTDIFFERENTIALB"
+    "RAILLE_DOTS_2356BRAILLE_DOTS_3467NCEDILLASABOVEDOTXF86CHANNELDOWNBRAILLE"
+    "_DOTS_1348CYRILLIC_O_BARWACUTESYS_REQISO_DISCONTINUOUS_UNDERLINEOPENTRIB"
+    "ULLETDOWNHPYDIAERESISARMENIAN_RAMUSICALSHARPARABIC_FATHAARABIC_1XF86MACR"
+    "O34XF86TOUCHPADTOGGLEARABIC_KASRATANCHF11KP_LEFTLATINCROSSCAPS_LOCKKP_NE"
+    "XTXF86HANGUPPHONEODOUBLEACUTETHAI_MAIEKBRAILLE_DOTS_256XF86TASKMANAGERXF"
+    "86SWITCH_VT_3SLASHSINH_DDHABRAILLE_DOT_5ARMENIAN_SHAARABIC_HEH_GOALARMEN"
+    "IAN_ERIGHTCARETARMENIAN_ZASERBIAN_TSHEARABIC_FEHACIRCUMFLEXACUTEF24SINH_"
+    "ALZSTROKEGREEK_TAUGREEK_OMEGAACCENTKP_5KANA_YAXF86KBDINPUTASSISTPREVGROU"
+    "PTHAI_SOSOTABTHAI_LEKSONGARMENIAN_FESUNSYS_REQARMENIAN_YECHBRAILLE_DOTS_"
+    "23467OURINGHELPXF86NUMERICASUPER_RF16PARTIALDERIVATIVEBRAILLE_DOTS_13467"
+    "DEAD_DIAERESISOSFENDLINECROSSINGLINESTABOVEDOTEM3SPACEODIAERESISXF86BREA"
+    "KHANGUL_SIOSF10THAI_LEKKAOGREEK_UPSILONACCENTFARSI_5BRAILLE_DOTS_157XF86"
+    "BRIGHTNESSMINKP_F2XF86VIEWF2OHORNBRAILLE_DOTS_2345HANGUL_EURIGHTTDCARONU"
+    "BREVETHAI_KHORAKHANGCCARONXF86WWWXF86TOUCHPADOFFSUNFA_CEDILLAHPBACKTABBR"
+    "AILLE_DOTS_1568XF86MACRO28SBRAILLE_DOTS_125678SEMICOLONBRAILLE_DOTS_8SUN"
+    "FA_TILDETHAI_KHOKHAIMARKERBRAILLE_DOTS_1235XF86FNRIGHTSHIFTPRIORYXF86SEA"
+    "RCHNOTIDENTICALBRAILLE_DOTS_234678DELETEHANGUL_YOXF86MAILFORWARDBRAILLE_"
+    "DOTS_12345678HSTROKEARABIC_HAMZAONYEHMULTIPLECANDIDATEACIRCUMFLEXHOOKBRA"
+    "ILLE_DOTS_35DEAD_ABOVERINGISO_LEVEL3_SHIFTXF86KBDINPUTASSISTACCEPTYGRAVE"
+    "SINH_YAOMACRONSINH_NYAXF86MACRO23XF86MACROPRESETCYCLETOPLEFTPARENSACIRCU"
+    "MFLEXBELOWDOTHANGUL_RIEULTIEUTARINGHANGUL_J_JIEUJARABIC_THALXF86AUDIONEX"
+    "TCYRILLIC_SOFTSIGNGEORGIAN_ENBRAILLE_DOTS_358GEORGIAN_CILOBARREDHANGUL_P"
+    "OSTHANJAHEBREW_TAWBRAILLE_DOTS_12568CYRILLIC_UTHAI_LEKSIHANGUL_RIEULKIYE"
+    "OGUCIRCUMFLEXXF86MACRO25KANA_HAODOUBLEACUTEXF86MACRORECORDSTARTISO_LEFT_"
+    "TABDOUBLEDAGGERBRAILLE_DOTS_3567THAI_MAITRIHANGUL_AFIVESIXTHSISO_FAST_CU"
+    "RSOR_DOWNOHORNACUTEUKRAINIAN_YISINH_NNADEAD_OENFILLEDCIRCBULLETBRAILLE_D"
+    "OTS_138F17SEVENSUPERIORGREEK_SIGMAHANGUL_J_KIYEOGBRAILLE_DOTS_28GREEK_ZE"
+    "TABRAILLE_DOTS_2456BRAILLE_DOTS_235678XF86PRESENTATIONCURSORXF86LIGHTBUL"
+    "BUHORNTILDEETHARABIC_COMMANABLAWECARONBRAILLE_DOTS_237ACUTEFFLOWLEFTCORN"
+    "ERXF86KBDLCDMENU1QUADUKRAINIAN_YIRETURNGREEK_ETAACCENT3270_PLAYGEORGIAN_"
+    "TARXF86MAILFOURSUBSCRIPTOCIRCUMFLEXBELOWDOTBOTTECIRCUMFLEXTILDEKANA_CHIA"
+    "RMENIAN_QUESTIONFILLEDRIGHTTRIBULLETTHAI_LEKHAXF86VIDEOOHORNHOOKXF86LAUN"
+    "CH1DAGGERBRAILLE_DOTS_137XF86DISPLAYOFFPARAGRAPHBRAILLE_DOTS_578CYRILLIC"
+    "_ZEKANA_SUHANGUL_YUUHORNBELOWDOTXF86MESSENGERTHAI_CHOCHOEQUOTEDBLARMENIA"
+    "N_BENBRAILLE_DOTS_234568BRAILLE_DOTS_168BRAILLE_DOTS_2458ARABIC_DAMMATAN"
+    "HANGUL_NIEUNNUM_LOCKHANGUL_IBRAILLE_DOTS_12356ARMENIAN_DAFILLEDRECTBULLE"
+    "TSINH_PHAXF86FULLSCREENCYRILLIC_YERUGEORGIAN_RAEARABIC_GHAINXF86RELOADTS"
+    "LASHXF86MODELOCKSINH_U2HEARTBRAILLE_DOT_3THAI_CHOCHANGTWOTHIRDSHEBREW_SA"
+    "MECHARABIC_2XF86DATABRAILLE_DOTS_158BRAILLE_DOTS_78F12XF86MEDIAREPEATCYR"
+    "ILLIC_YANAIRASIGNKCEDILLASINH_AU2BROKENBARDEAD_GRAVEXF86MACROPRESET2XF86"
+    "CONTRASTADJUSTKP_EQUALXF86EDITORHANGUL_YEBRAILLE_DOTS_1457KANA_KAHEBREW_"
+    "FINALPECOLONSIGNARMENIAN_INIBRAILLE_DOTS_2378UKRAINIAN_IREDOONETHIRDFIGD"
+    "ASHARMENIAN_KEF33PXF86AUDIOPLAYARABIC_ALEFAETSINH_UU2XF86RIGHTDOWNF9XF86"
+    "DOCUMENTSUUNDOXF86MACRO21GREEK_ETAGREEK_UPSILONDIERESISOSFEXTENDSLOWKEYS"
+    "_ENABLEXF86CHANNELUPARABIC_AINTHAI_THOTHAHANSINH_OO2LCARONABREVEGRAVELEF"
+    "TOPENTRIANGLEEIGHTSUPERIORHANGUL_J_RIEULXF86LAUNCHEXF86SWITCH_VT_8XF86NE"
+    "WSAXF86DOSIMPLIESSINH_UUTOPLEFTRADICALCYRILLIC_ELELLIPSISF13CYRILLIC_UAR"
+    "MENIAN_EXCLAMARMENIAN_APOSTROPHERIGHTPOINTEROSFBEGINDATABRAILLE_DOTS_12B"
+    "RAILLE_DOTS_247BRAILLE_DOTS_2567CYRILLIC_OUACUTEPOINTER_DRAG_DFLTHANGUL_"
+    "J_RIEULPHIEUFISO_GROUP_LOCKARABIC_PEHKANA_REHANGUL_IEUNGKTHAI_PHINTHUARA"
+    "BIC_HAMZA_BELOWKANA_UXF86MACRORECORDSTOPRIGHTF19CYRILLIC_O_BARKP_DECIMAL"
+    "TWOSUBSCRIPTBRAILLE_DOTS_1278SERBIAN_DJEXF86STARTXF86AUDIOPRESETBRAILLE_"
+    "DOTS_267XF86KBDLIGHTONOFFBRAILLE_DOTS_23567CCEDILLA3270_TESTMAHOOKCYRILL"
+    "IC_SOFTSIGNPOINTER_DRAG2TELEPHONERECORDERALT_LSINGLELOWQUOTEMARKSINH_NG2"
+    "XF86TERMINALCYRILLIC_CHE_DESCENDERBRAILLE_DOTS_1368THREESUBSCRIPTOVERLIN"
+    "EBOTLEFTSUMMATIONPROLONGEDSOUNDCYRILLIC_ZETHAI_PHOPHANXF86ADDFAVORITEKP_"
+    "F4OSFRESTOREBRAILLE_DOTS_678BOTVERTSUMMATIONCONNECTORXF86SHOPISO_NEXT_GR"
+    "OUPSINH_VACURRENCYARMENIAN_AYBBYELORUSSIAN_SHORTUTOPVERTSUMMATIONCONNECT"
+    "ORORDFEMININEXF86LAUNCH5WDIAERESISBRAILLE_DOTS_123478CYRILLIC_KABRAILLE_"
+    "DOTS_23478BRAILLE_DOTS_2468LFONESIXTHODIAERESISOSFDELETEREGISTEREDSECTIO"
+    "NPABOVEDOTXF86AUDIORANDOMPLAYXF86FORWARDITILDE3270_BACKTABEBELOWDOTYGRAV"
+    "EBRAILLE_DOTS_24567GCARONOSFHELPKANA_HIBRAILLE_DOTS_1346XF86FRAMEBACKHEB"
+    "REW_QOPHBRAILLE_DOTS_12578MASSYOXF86AUDIORECORDVBRAILLE_DOTS_1345678CYRI"
+    "LLIC_LJEOSFPREVFIELDGREEK_NUCYRILLIC_HABRAILLE_DOTS_12345ADIAERESISGREEK"
+    "_IOTACYRILLIC_KA_VERTSTROKECYRILLIC_NJEARABIC_ZAHBRAILLE_DOTS_457SINH_KH"
+    "AINTEGRALHANGUL_MIEUMUGRAVEUHORNXF86SWITCH_VT_5BRAILLE_DOTS_5BOTRIGHTPAR"
+    "ENSGREEK_ETAACCENTXF86CALENDARBRAILLE_DOTS_124568CACUTEBRAILLE_DOTS_1245"
+    "7SINH_AI2BRAILLE_DOTS_2578ARMENIAN_PYUREQUALXF86ONSCREENKEYBOARDOHORNBEL"
+    "OWDOTISO_PARTIAL_LINE_UPNSHIFT_RXF86BLUEPLUSBRAILLE_DOTS_2358XF86KBDLCDM"
+    "ENU2ARMENIAN_TSOARABIC_DDALGREEK_EPSILONACCENTEDIAERESISBRAILLE_DOTS_457"
+    "8HEBREW_CHETSINH_RU2CYRILLIC_GHE_BARHANGUL_RIEULSIOSXF86REPLYOSFQUICKPAS"
+    "TEHANGUL_J_NIEUNHIEUHXF8610CHANNELSDOWNCYRILLIC_GHESUNPOWERSWITCHSHIFTXF"
+    "86STOPXF86MONBRIGHTNESSCYCLEXF86LAUNCH0EMDASHRIGHTTACKF4CYRILLIC_U_MACRO"
+    "NPOINTER_DRAG3BRAILLE_DOTS_2345678OCARONDOUBBASELINEDOTCONTROL_RLEFTMIDD"
+    "LECURLYBRACEHANGUL_SPECIALSINH_DHHAXF86ITOUCHXF86TOOLSDSTROKEBRAILLE_DOT"
+    "S_134578BRAILLE_DOTS_23PABOVEDOTSUNFA_GRAVEKANA_TSUXF86RFKILLHANGUL_J_KH"
+    "IEUQARMENIAN_KENGREEK_GAMMAPAUSEPOINTER_BUTTON4BRAILLE_DOTS_368VOIDSYMBO"
+    "LSINH_AE2XF86NUMERIC9GREEK_PHIBRAILLE_DOTS_367THREESUPERIORBRAILLE_DOTS_"
+    "123578ESCAPEHPDELETECHAROSFNEXTFIELDTHAI_SARAAPARENRIGHTBALLOTCROSSLEFTA"
+    "NGLEBRACKETBRAILLE_DOTS_156BRAILLE_DOTS_134563270_RIGHT2LACUTENACUTEOCIR"
+    "CUMFLEXHOOKKP_SEPARATORSINH_THHACYRILLIC_U_STRAIGHT_BARXABOVEDOTHEBREW_G"
+    "IMELGABOVEDOTENOPENCIRCBULLETPERIODCENTEREDXF86UNMUTEZ3270_COPYBRAILLE_D"
+    "OTS_47XF86LAUNCHFMASCULINEFARSI_3GREEK_IOTAACCENTDOUBLELOWQUOTEMARKXF86N"
+    "UMERIC8UBELOWDOTARABIC_JEEMBRAILLE_DOTS_234XF86USER1KBBRAILLE_DOTS_1356G"
+    "EORGIAN_HOEDEAD_AOGRAVEBRAILLE_DOTS_1478HPCLEARLINEBRAILLE_DOTS_347NOTAP"
+    "PROXEQXF86MENUPBENDASHBRAILLE_DOTS_1258IOGONEKCYRILLIC_CHEOSFCOPYBRAILLE"
+    "_DOTS_3457THAI_MAITAIKHUHEBREW_DOUBLELOWLINEMENUDOLLARF32POINTER_DOWNF22"
+    "HANGUL_PHIEUFHANGUL_SSANGPIEUBECIRCUMFLEXTILDECYRILLIC_CHE_DESCENDERGREE"
+    "K_LAMDABRAILLE_DOTS_24568CYRILLIC_IEBRAILLE_DOTS_1234568HANGUL_EBRAILLE_"
+    "DOTS_134678ACIRCUMFLEXTILDESINH_E2KANA_SHIOCIRCUMFLEXGRAVESINH_RAXF86ASP"
+    "ECTRATIOVERTBARBRAILLE_DOTS_13578BRAILLE_DOTS_3458TOPLEFTSQBRACKETRCEDIL"
+    "LATHAI_SARAICYRILLIC_EMRIGHTOPENTRIANGLEARABIC_SUPERSCRIPT_ALEFBRAILLE_D"
+    "OTS_1245678HPLIRAEMACRONSINH_GHAHANGUL_J_DIKEUDXF86ROTATIONKBONESUBSCRIP"
+    "TISO_LEVEL3_LATCH3270_JUMPSINH_H2OSFSELECTBRAILLE_DOTS_147ARABIC_SHADDAF"
+    "IRST_VIRTUAL_SCREENRCARONARABIC_VEHARMENIAN_FEARABIC_TAHHANGUL_WAVOICEDS"
+    "OUNDXF86LOGOFFHANGUL_PANSIOSARMENIAN_TYUNXF86LAUNCH8SHIFT_LOCKJOTISO_LEV"
+    "EL3_LOCKFOURFIFTHSARMENIAN_TSATHAI_LAKKHANGYAOARMENIAN_VOLOGICALORSINH_L"
+    "LATHAI_THOTHONGGEORGIAN_KANARABIC_YEH_BAREENUMBERSIGNKANA_KOXF86LOGWINDO"
+    "WTREEARMENIAN_ZHEBRAILLE_DOT_8THAI_SARAOGREEK_UPSILONFISO_LEVEL2_LATCHAB"
+    "REVESUNPROPSOSFACTIVATESINH_DDAXF86LEFTUPAOGONEKTHAI_THOTHUNGXF86MENUKBA"
+    "RMENIAN_YECHXF86REDBRAILLE_DOTS_1256BRAILLE_DOTS_2457BRAILLE_DOT_4KANA_U"
+    "GABOVEDOTHANGUL_AEBRAILLE_DOTS_68NEXTUPCARETF28ISO_PARTIAL_SPACE_LEFTXF8"
+    "6AUDIOSINH_NGSINH_RII3270_EXSELECTHANGUL_JIEUJKP_6BRAILLE_DOTS_38ARMENIA"
+    "N_KENGEORGIAN_MANKANA_FUUHORNGRAVEXF86CAMERAZOOMINGREEK_TAURACUTEXCYRILL"
+    "IC_KATHAI_LEKNUNGTHAI_SARAAIMAIMUANCOMBINING_BELOWDOTSCIRCUMFLEXARMENIAN"
+    "_SHABRAILLE_DOTS_145XF86NUMERIC7HEBREW_SHINABREVETILDEBRAILLE_DOTS_3456Y"
+    "LSTROKE3270_SETUPECIRCUMFLEXHOOKHCIRCUMFLEXDEAD_BELOWRINGXF86WEBCAMKP_SU"
+    "BTRACTEACUTEXF86COPYXF86KBDINPUTASSISTNEXTGROUPXF86MONBRIGHTNESSDOWNCYRI"
+    "LLIC_SHACYRILLIC_ADEAD_VOICED_SOUNDKANA_NUUDOUBLEACUTEMINUSBRAILLE_DOTS_"
+    "12678ETHXF86MACRO19QHANGUL_YAEISO_FAST_CURSOR_LEFTKANA_TOHORIZLINESCAN1P"
+    "UNCTSPACEHANGUL_J_PIEUBSIOSHEBREW_DALETKANA_MUCYRILLIC_PEHPMUTE_DIAERESI"
+    "SDOWNSHOEARMENIAN_DAHEBREW_ALEPHTHAI_YOYINGKANA_SOGEORGIAN_JHANBRAILLE_D"
+    "OTS_1458XF86ZOOMINHANGUL_RIEULYEORINHIEUHSCEDILLASSHARPISO_SET_MARGIN_RI"
+    "GHTGBREVEXF86BLUETOOTHXF86FNCYRILLIC_EMRACUTETHAI_KHOKHUATF5SQUAREROOTBR"
+    "AILLE_DOTS_1456CYRILLIC_BELIRASIGNBRAILLE_DOTS_135HEBREW_AYINEXECUTEFARS"
+    "I_0HPINSERTLINEKANA_KUBRAILLE_DOTS_36ARMENIAN_LIGATURE_EWXF86MACRO12AMAC"
+    "RONBRAILLE_DOTS_1234567F29SINH_PAACIRCUMFLEXARMENIAN_KEUBREVEUHORNGRAVEG"
+    "REEK_EPSILONARMENIAN_ATFIVEEIGHTHSCYRILLIC_KA_VERTSTROKEZACUTEOPENSTARLX"
+    "F86WWANELEMENTOFARABIC_HAHGREEK_OMICRONACCENTHANGUL_KIYEOGSIOSKANA_MEDEA"
+    "D_ICYRILLIC_SHCHAGEORGIAN_HARXF86PAUSERECORDBRAILLE_DOTS_238"
+    ;
+
+#endif
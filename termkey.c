@@ -8,42 +8,206 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
 #include <ctype.h>
+#include <dirent.h>
+#include <linux/input.h>         // For the evdev backend
+#include <linux/futex.h>         // For waking --view readers of the event bus
+#include <sys/syscall.h>         // For SYS_futex and SYS_gettid
+#include <limits.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netdb.h>                // For --stream host resolution
 #include <X11/Xlib.h>
 #include <X11/Xproto.h>          // For xEvent
-#include <X11/XKBlib.h>          // For XkbKeycodeToKeysym
+#include <X11/XKBlib.h>          // For XkbGetMap and keymap notifications
 #include <X11/keysym.h>
 #include <X11/X.h>
 #include <X11/extensions/record.h>
+#ifdef TERMKEY_BENCH
+#include <X11/extensions/XTest.h>  // For XTestFakeKeyEvent in --latency-bench
+#endif
 #include <signal.h>
+#include "keysym_names.h"         // Generated by tools/gen_keysym_names.py
 
 #define MAX_MESSAGE_LENGTH 256
+#define MAX_FRAME_MESSAGE  (MAX_MESSAGE_LENGTH * 2 + 10)
 #define COLOR_NAME_LENGTH  20
+#define MAX_EPOLL_EVENTS   8
+#define MAX_KEYCODES       256
+#define KEY_LABEL_LENGTH   64
+#define FRAME_BUFFER_SIZE  8192
+#define EVENT_RING_SIZE    1024   // Must be a power of two
+#define INTERCEPT_BATCH    32     // Records decoded from one intercept before they are queued
+#define MAX_EVDEV_DEVICES  32
+#define EVDEV_READ_EVENTS  64     // input_events read from a device per read(2)
+#define SYNC_PROBE_TIMEOUT 200    // Milliseconds to wait for the terminal's DECRQM reply
+#define LOG_CHUNK_SIZE     (1 << 20) // Event log grows and is mapped in chunks of this size
+#define LOG_MAGIC          "TKEYLOG"
+#define LOG_VERSION        1
+#define MAX_SOURCES        32     // X displays captured at once (-d); evdev uses source 0
+#define SOURCE_TAG_LENGTH  40
+#define BUS_SLOTS          4096   // Records kept in the shared-memory bus; must be a power of two
+#define BUS_MAGIC          "TKEYBUS"
+#define BUS_VERSION        1
+#define BUS_NAME_LENGTH    64
+#define STREAM_PACKET_SIZE 1400   // Stays under a typical path MTU
+#define STREAM_HEADER_SIZE 12
+#define STREAM_RECORD_SIZE 12
+#define STREAM_VERSION     1
+#define STREAM_BUTTON_BASE (MAX_SOURCES * MAX_KEYCODES) // Label ids of mouse buttons start here
+#define STREAM_BUTTONS     10     // Buttons 1-9 have label ids
 
-// Global variables for display connections
-static Display *display = NULL;        // Display for keyboard events
-static Display *record_display = NULL; // Display for recording events
+// An input backend. Each one decodes its own events with decode_input(), which
+// applies the modifier state and key table, and queues the records together.
+typedef struct {
+    int (*open)(void);                      // Start capturing and add fds to epoll_fd
+    void (*dispatch)(void *handle, uint32_t events); // Handle readiness of one of its fds,
+                                            // given the data.ptr it registered the fd with
+    void (*close)(void);                    // Stop capturing; safe if open() failed
+} InputSource;
+
+// evdev backend (--evdev), reading /dev/input/event* without an X server
+static int evdev_fds[MAX_EVDEV_DEVICES];    // -1 once a device is unplugged
+static int evdev_count = 0;                 // Devices opened, unplugged ones included
+static const char *evdev_paths[MAX_EVDEV_DEVICES]; // Devices named with --evdev-device
+static int evdev_path_count = 0;                 // 0 means every keyboard and pointer
+
+// Event loop file descriptors
+static int epoll_fd  = -1;             // Multiplexes the X connection, signals and timers
+static int signal_fd = -1;             // Delivers SIGINT/SIGTERM/SIGWINCH as readable events
+static int timer_fd  = -1;             // Periodic tick, armed only when something needs it
+static atomic_int running = 1;         // Cleared when the main loop should exit
+
+// Wakeup accounting
+static int show_wakeups = 0;           // Print wakeups per second to stderr (--wakeups)
+static atomic_ulong loop_wakeups = 0;  // Main loop wakeups since startup
+static atomic_ulong render_wakeups = 0;// Render thread wakeups since startup
+
+// Frame output, composed in one buffer and sent with a single write(2); a
+// frame that outgrows it is flushed in pieces instead of being cut short
+static int output_fd = STDOUT_FILENO;        // Where frames are written
+static char frame_buffer[FRAME_BUFFER_SIZE];
+static size_t frame_len = 0;
+static int show_frame_bytes = 0;             // Print frame byte counts to stderr (--frame-bytes)
+static atomic_ulong frame_count = 0;         // Frames written since startup
+static atomic_ulong frame_bytes_total = 0;   // Bytes written since startup
+
+// Runtime statistics, dumped on SIGUSR1 and, with --stats, at exit. Every
+// counter has a single writer thread, so stat_add() is a relaxed load and
+// store rather than a locked read-modify-write.
+#define LATENCY_BUCKETS    240        // 16 linear + 8 sub-buckets per power of two up to 2^31 us
+#define LATENCY_MAX_MS     60000      // Larger gaps mean the server clock is not ours
+
+static atomic_ulong event_counts[4];         // Indexed by type - KeyPress
+static atomic_ulong latency_histogram[LATENCY_BUCKETS]; // server_time -> frame written, in us
+static atomic_ulong latency_unmatched = 0;   // Frames whose server_time was not comparable
+static int stats_at_exit = 0;                // Dump statistics when exiting (--stats)
+static const char *stats_path = NULL;        // Append dumps here instead of stderr (--stats-file)
+
+// Terminal geometry, refreshed only on SIGWINCH
+static int term_rows = 24;
+static int term_cols = 80;
+
+// Message currently on screen, kept so a resize can redraw it
+static char current_message[MAX_FRAME_MESSAGE] = "";
+static int current_phase = 0;                // Colour blink phase the message was drawn with
+static unsigned int current_repeat = 1;      // Times the message repeated within the window
+static int current_message_width = 0;        // Cells of the message without its repeat counter
+
+// Span of the last frame, so the next one only overwrites the cells that changed
+static int last_frame_row = 0;               // 1-based terminal row
+static int last_frame_col = 0;               // 0-based column of the first cell
+static int last_frame_width = 0;             // Cells covered, 0 if nothing is drawn
+static int screen_dirty = 1;                 // Clear the whole screen before the next frame
+
+// Synchronized output (DEC private mode 2026), so each frame is one atomic update
+static int sync_output = 0;                  // Requested with --sync, cleared if unsupported
+
+// Earlier combos stacked below the current one (--history). Entries are kept
+// preformatted in a fixed ring; a new one is scrolled in with a scroll region,
+// so only the new line and the lines that change fade level are drawn
+#define HISTORY_MAX         32        // Power of two, so slots wrap with a mask
+#define HISTORY_TEXT        (MAX_FRAME_MESSAGE + 24) // Message plus its repeat counter
+#define HISTORY_FADE_LEVELS 4
+
+typedef struct {
+    char text[HISTORY_TEXT];
+    uint16_t len;                     // Bytes of text
+    uint16_t message_len;             // Bytes before the repeat counter, used for centring
+    uint16_t width;                   // Cells of the whole text
+} HistoryEntry;
+
+static HistoryEntry history[HISTORY_MAX];
+static unsigned int history_lines = 0;       // Lines below the message, 0 to disable (--history)
+static unsigned int history_next = 0;        // Slot the next entry goes into
+static unsigned int history_count = 0;       // Entries stored, at most HISTORY_MAX
+static unsigned int history_unscrolled = 0;  // Entries added since the pane was last drawn
+static int history_armed = 0;                // Set once a combo has replaced the startup banner
+static const int history_fade[HISTORY_FADE_LEVELS] = {250, 246, 242, 238}; // 256-colour greys, newest first
+
+// Modifier keys state, one bit per modifier in the order they are displayed
+typedef uint16_t ModifierState;
 
-// Mouse button state
-static int mouse_button_pressed = 0;   // Indicates if a mouse button is pressed
+enum {
+    MOD_CTRL_L  = 1 << 0,
+    MOD_CTRL_R  = 1 << 1,
+    MOD_ALT_L   = 1 << 2,
+    MOD_ALT_R   = 1 << 3,
+    MOD_SHIFT_L = 1 << 4,
+    MOD_SHIFT_R = 1 << 5,
+    MOD_META_L  = 1 << 6,
+    MOD_META_R  = 1 << 7,
+    MOD_ALTGR   = 1 << 8,
+    MOD_SUPER_L = 1 << 9,
+    MOD_SUPER_R = 1 << 10
+};
+
+#define MODIFIER_COUNT         11
+#define MODIFIER_COMBINATIONS  (1 << MODIFIER_COUNT)
+#define MODIFIER_PREFIX_LENGTH 128
+
+// "CONTROL_L + ALT_L + " style prefixes, built on first use for each mask
+typedef struct {
+    int built;
+    size_t len;
+    char text[MODIFIER_PREFIX_LENGTH];
+} ModifierPrefix;
 
-// Modifier keys state
+static ModifierPrefix modifier_prefixes[MODIFIER_COMBINATIONS];
+static const char *const modifier_names[MODIFIER_COUNT] = {
+    "CONTROL_L + ", "CONTROL_R + ", "ALT_L + ", "ALT_R + ",
+    "SHIFT_L + ", "SHIFT_R + ", "META_L + ", "META_R + ",
+    "ALTGR + ", "SUPER_L + ", "SUPER_R + "
+};
+
+// Event filter (--only-combos, --exclude-keys, --mouse-only), compiled from the
+// command line into a keycode bitset and a modifier mask. A key event that
+// fails it is dropped right after modifier tracking, before it is logged,
+// published, streamed or formatted; mouse events always pass
 typedef struct {
-    int shift_l;
-    int shift_r;
-    int ctrl_l;
-    int ctrl_r;
-    int alt_l;
-    int alt_r;
-    int meta_l;
-    int meta_r;
-    int altgr;
-    int super_l;
-    int super_r;
-} ModifierState;
-
-static ModifierState modifiers = {0};
+    uint64_t keys[MAX_KEYCODES / 64]; // Bit set for every keycode that may be shown
+    ModifierState require_any;        // Non-modifier keys need one of these held, 0 for none
+} EventFilter;
+
+static EventFilter event_filter = {{~0ULL, ~0ULL, ~0ULL, ~0ULL}, 0};
+static int filter_active = 0;                // Any filter option was given
+static atomic_ulong events_filtered = 0;     // Key events the filter dropped
 
 // Color-related variables
 static int use_color = 0;                              // Flag to activate/deactivate color function
@@ -51,6 +215,18 @@ static char bg_color_name[COLOR_NAME_LENGTH] = "default";   // Background color
 static char fg_color_name[COLOR_NAME_LENGTH] = "default";   // Foreground color name
 static char letter_color_name[COLOR_NAME_LENGTH] = "";      // Letter color name
 
+// Escape sequences for one phase of the colour blink, resolved once at startup
+typedef struct {
+    const char *prefix;       // Background code emitted at the start of the frame
+    size_t prefix_len;
+    const char *graph_code;   // Code for runs of isgraph characters
+    size_t graph_len;
+    const char *blank_code;   // Code for runs of other characters
+    size_t blank_len;
+} ColorPhase;
+
+static ColorPhase color_phases[2];    // [0] normal, [1] background/foreground swapped
+
 // Special key mapping
 typedef struct {
     KeySym keysym;
@@ -100,18 +276,448 @@ static const KeyMap special_key_map[] = {
 
 #define SPECIAL_KEY_MAP_SIZE (sizeof(special_key_map) / sizeof(KeyMap))
 
+// Keycode lookup table, built at startup and whenever the keymap changes
+typedef struct {
+    KeySym keysym;                    // Group 0, level 0 keysym for the keycode
+    ModifierState modifier_bit;       // Bit in ModifierState if this is a modifier key
+    size_t len;                       // Length of label, 0 if the key has no name
+    char label[KEY_LABEL_LENGTH];     // Uppercased display name
+} KeyLabel;
+
+// One captured display, with its own connections, keymap and input state.
+// RECORD streams intercepted data on the connection that enabled the context
+// and disables it from another one, so there are two per display: nothing on
+// the hot path ever talks to the control connection.
+typedef struct {
+    const char *name;                 // DISPLAY name from -d, NULL for $DISPLAY
+    Display *display;                 // Control: keymap notifications, record context management
+    Display *record_display;          // Data: carries only the intercepted events
+    XRecordContext record_context;
+    XRecordRange *record_range;
+    int record_enabled;               // Context must be disabled before it is freed
+    int xkb_event_base;               // First event code of the XKB extension
+
+    ModifierState modifiers;          // Modifier keys held on this display
+    int mouse_button_pressed;         // Mouse button held on this display, 0 if none
+
+    // Used only by the thread that decodes this display's events; everything
+    // downstream works from the keysym carried in each record
+    KeyLabel key_labels[MAX_KEYCODES];
+
+    char tag[SOURCE_TAG_LENGTH];      // "[:1] " prefix shown when several displays are captured
+    size_t tag_len;
+} CaptureSource;
+
+static CaptureSource sources[MAX_SOURCES];
+static int source_count = 0;          // Number of -d arguments, or 1 for the default display
+static int sources_live = 0;          // Displays still connected; capture stops at 0
+static atomic_int show_source_tags = 0; // Prefix every message with its display's tag
+
+// Compact record of one decoded input event, passed from capture to render.
+// The same 16-byte layout is what the --log file stores after its header.
+typedef struct {
+    uint32_t server_time;             // XRecord server timestamp in milliseconds
+    uint32_t keysym;                  // Resolved keysym for key events, 0 for buttons
+    ModifierState modifiers;          // Modifier state after this event was applied
+    uint8_t type;                     // KeyPress, KeyRelease, ButtonPress or ButtonRelease
+    uint8_t detail;                   // Keycode or button number
+    uint8_t mouse_button;             // Mouse button held when the event happened
+    uint8_t source;                   // Index of the display it came from
+    uint8_t reserved[2];              // Zero, except for the --latency-bench sample tag
+} EventRecord;
+
+// Header at the start of a --log file
+typedef struct {
+    char magic[8];                    // LOG_MAGIC, NUL padded
+    uint32_t version;                 // LOG_VERSION
+    uint32_t record_size;             // sizeof(EventRecord)
+} LogHeader;
+
+// Binary event log, appended through a memory-mapped window that grows in chunks
+static int display_enabled = 1;              // Cleared by --no-display for headless logging
+static const char *log_path = NULL;          // Opened once every option has been checked (--log)
+static int log_fd = -1;
+static unsigned char *log_map = NULL;        // Mapping of the current chunk
+static off_t log_map_offset = 0;             // File offset of the current chunk
+static size_t log_map_used = 0;              // Bytes used in the current chunk
+
+// Replay of a recorded log through the render pipeline, without an X server
+static const char *replay_path = NULL;       // Log to replay (--replay)
+static int replay_fast = 0;                  // Ignore recorded timing (--replay-fast)
+
+#ifdef TERMKEY_BENCH
+static size_t latency_bench_events = 0;      // Presses in the --latency-bench run, 0 if disabled
+#endif
+
+#ifdef TERMKEY_TRACE
+// Stage tracing (--trace), built with -DTERMKEY_TRACE. Each traced thread
+// appends begin/end events to its own preallocated double buffer; full halves
+// are handed to a flusher thread that writes them out as Chrome trace JSON.
+#define TRACE_HALF_EVENTS  8192       // Events per half of a thread's buffer
+#define TRACE_MAX_THREADS  4
+
+typedef struct {
+    const char *name;                 // Stage name, always a string literal
+    uint64_t ts;                      // CLOCK_MONOTONIC nanoseconds
+    char phase;                       // 'B' or 'E'
+} TraceEvent;
+
+typedef struct {
+    TraceEvent events[2][TRACE_HALF_EVENTS];
+    size_t used[2];
+    atomic_int full[2];               // Half is waiting for the flusher
+    int current;                      // Half the owning thread appends to
+    int tid;
+    const char *thread_name;
+    atomic_ulong dropped;             // Events lost while both halves were full
+} TraceBuffer;
+
+static const char *trace_path = NULL;        // Chrome trace JSON output (--trace)
+static FILE *trace_file = NULL;
+static TraceBuffer trace_buffers[TRACE_MAX_THREADS];
+static atomic_int trace_buffer_count = 0;    // Buffers handed out to threads
+static _Thread_local TraceBuffer *trace_buffer = NULL;
+static pthread_t trace_thread;
+static int trace_wake_fd = -1;               // eventfd signalled when a half fills up
+static atomic_int trace_running = 0;
+static int trace_first_event = 1;            // No comma before the first JSON object
+
+#define TRACE_THREAD(name) trace_register(name)
+#define TRACE_BEGIN(name)  trace_event(name, 'B')
+#define TRACE_END(name)    trace_event(name, 'E')
+#else
+#define TRACE_THREAD(name) ((void)0)
+#define TRACE_BEGIN(name)  ((void)0)
+#define TRACE_END(name)    ((void)0)
+#endif
+
+#ifdef TERMKEY_ALLOC_CHECK
+// Allocation check, built with -DTERMKEY_ALLOC_CHECK. The event path only uses
+// storage set up at startup; to keep it that way malloc is interposed and,
+// once ALLOC_WARMUP_SCOPES event-processing scopes have run, any allocation
+// made inside one aborts with the name of the scope.
+#define ALLOC_WARMUP_SCOPES 64
+
+static _Thread_local const char *alloc_scope = NULL; // Event-processing scope the thread is in
+static atomic_ulong alloc_scopes_done = 0;           // Scopes completed since startup
+
+#define ALLOC_SCOPE_BEGIN(name) (alloc_scope = (name))
+#define ALLOC_SCOPE_END()       (alloc_scope = NULL, (void)atomic_fetch_add_explicit(&alloc_scopes_done, 1, memory_order_relaxed))
+#else
+#define ALLOC_SCOPE_BEGIN(name) ((void)0)
+#define ALLOC_SCOPE_END()       ((void)0)
+#endif
+
+// Shared-memory event bus (--daemon/--view). One capture process publishes
+// records; any number of viewers read them without coordinating with it. Each
+// slot carries the sequence number of the record in it, written after the
+// record, so a reader that was lapped sees a different number and knows how
+// many records it lost.
+typedef struct {
+    atomic_uint_least64_t seq;        // Sequence number + 1 of the record held, 0 while written
+    atomic_uint_least64_t data[2];    // The 16-byte EventRecord
+} BusSlot;
+
+typedef struct {
+    char magic[8];                    // BUS_MAGIC, NUL padded
+    uint32_t version;                 // BUS_VERSION
+    uint32_t record_size;             // sizeof(EventRecord)
+    uint32_t slot_count;              // BUS_SLOTS
+    uint32_t reserved;
+    _Alignas(64) atomic_uint_least64_t write_seq; // Sequence number of the next record
+    atomic_uint futex_word;           // Low 32 bits of write_seq, for FUTEX_WAIT
+    atomic_uint waiters;              // Viewers blocked in FUTEX_WAIT
+    _Alignas(64) BusSlot slots[BUS_SLOTS];
+} EventBus;
+
+static EventBus *bus = NULL;                 // Mapping of the bus this process publishes to or views
+static char bus_name[BUS_NAME_LENGTH];       // shm_open name, "/termkey-<name>"
+static int bus_publisher = 0;                // Set by --daemon
+static pthread_t bus_thread;                 // Viewer thread copying the bus into the ring
+static atomic_int bus_reading = 0;
+static atomic_int bus_reader_done = 0;       // Set by the reader thread as it exits
+static atomic_ulong bus_overruns = 0;        // Records a viewer lost because it fell behind
+
+// Network streaming (--stream). Records go out in batched datagrams with a
+// label id instead of the label; the receiver learns the ids from label packets
+// sent at startup, whenever a keymap changes, and when it sends us anything.
+enum {
+    STREAM_EVENTS = 1,                // Packet of STREAM_RECORD_SIZE records
+    STREAM_LABELS = 2                 // Packet of (id, length, label) entries
+};
+
+static const char *stream_addr = NULL;       // udp:host:port or unix:path (--stream)
+static unsigned int stream_flush_us = 1000;  // Longest a record waits for its packet (--stream-flush)
+static int stream_fd = -1;
+static int stream_timer_fd = -1;             // Flush deadline of the packet being filled
+static unsigned char stream_packet[STREAM_PACKET_SIZE];
+static size_t stream_packet_len = 0;         // 0 while no records are waiting
+static uint32_t stream_sequence = 0;         // Packet counter, so receivers can see losses
+static uint16_t stream_generation = 0;       // Label table version the records refer to
+static atomic_int stream_labels_dirty = 1;   // A key table changed since labels were last sent
+static atomic_ulong stream_packets = 0;      // Datagrams sent
+static atomic_ulong stream_send_errors = 0;  // Datagrams the socket refused
+
+// Key usage statistics (--key-stats, --heatmap). Flat counters per keycode, per
+// modifier mask and per button, plus an open-addressing table of (modifier
+// mask, keycode) combos. Only the thread that decodes events writes them; the
+// exporter thread reads them while they grow, and labels them from the keysyms
+// stored next to the counts rather than from a keymap table
+#define COMBO_SLOTS        4096       // Power of two
+#define COMBO_MAX_PROBES   16         // A combo that finds no slot this close counts as overflow
+#define KEY_STATS_BUTTONS  16
+
+typedef struct {
+    atomic_uint key;                  // source << 19 | mask << 8 | keycode, plus one; 0 while free
+    atomic_uint keysym;               // Keysym of the first press counted
+    atomic_ulong count;
+} ComboSlot;
+
+static int key_stats_enabled = 0;            // Set by --key-stats or --heatmap
+static const char *key_stats_path = NULL;    // CSV, or JSON if the name ends in .json (--key-stats)
+static unsigned int key_stats_interval = 60; // Seconds between exports (--key-stats-interval)
+static int show_heatmap = 0;                 // Add a keyboard heatmap to the stats dump (--heatmap)
+static atomic_ulong key_counts[MAX_KEYCODES];
+static atomic_uint key_keysyms[MAX_KEYCODES]; // Keysym of the last press counted for each keycode
+static atomic_ulong modifier_mask_counts[MODIFIER_COMBINATIONS];
+static atomic_ulong button_counts[KEY_STATS_BUTTONS];
+static ComboSlot combo_slots[COMBO_SLOTS];
+static atomic_ulong combo_overflow = 0;      // Combos the table had no room for
+static pthread_t key_stats_thread;
+static int key_stats_wake_fd = -1;           // eventfd that stops the exporter
+static atomic_int key_stats_running = 0;
+
+// Lock-free single-producer/single-consumer ring between the two threads
+typedef struct {
+    EventRecord records[EVENT_RING_SIZE];
+    _Alignas(64) atomic_size_t head;  // Next slot the capture thread writes
+    _Alignas(64) atomic_size_t tail;  // Next slot the render thread reads
+} EventRing;
+
+static EventRing event_ring;
+static atomic_size_t ring_high_water = 0;    // Largest ring occupancy seen
+static atomic_ulong ring_dropped = 0;        // Records lost because the ring was full
+static atomic_ulong ring_pushed = 0;         // Records queued for the render thread
+static int show_ring_stats = 0;              // Print ring counters to stderr (--ring-stats)
+
+// Render thread
+static pthread_t render_thread;
+static int render_wake_fd = -1;              // eventfd the capture thread signals
+static size_t render_wake_head = 0;          // Ring head when the render thread was last woken
+static atomic_int resize_pending = 0;        // Set by SIGWINCH, handled by the render thread
+static atomic_ulong frames_coalesced = 0;    // Frame-producing records superseded before drawing
+
+// Autorepeat and burst aggregation
+static unsigned int repeat_window = 700;     // Milliseconds within which a repeat is counted (--repeat-window)
+static uint64_t last_repeat_key = 0;         // Identity of the last frame-producing record
+static uint32_t last_repeat_time = 0;        // Its server timestamp
+
+// Labels the render thread has resolved from record keysyms, direct-mapped by keysym hash
+#define RENDER_LABEL_SLOTS 256        // Power of two
+static KeyLabel render_key_labels[RENDER_LABEL_SLOTS];
+
+// Latest state collected from the ring but not drawn yet (latest wins)
+static char pending_message[MAX_FRAME_MESSAGE];
+static unsigned int pending_repeat = 1;      // Repeat count the next frame will show
+static int pending_new_message = 0;          // A different combo has to be drawn
+static int pending_repeat_only = 0;          // Only the repeat counter changed
+static unsigned long pending_records = 0;    // Frame-producing records since the last frame
+
+// Frame-rate limiter
+static unsigned int max_fps = 0;             // Frames per second cap, 0 for unlimited (--max-fps)
+static int render_timer_fd = -1;             // Deadline for the next frame the limiter allows
+static int render_timer_armed = 0;
+static struct timespec next_frame_time;      // Earliest time the next frame may be written
+
+// Named key sequences (--sequences), compiled at startup into a trie whose
+// edges live in an open-addressing table keyed on (node, modifier kinds,
+// keysym). The render thread advances it with one lookup per key press, holds
+// back the frames of a sequence in progress and draws the action's name once
+// it completes; --sequence-timeout without a stroke resets it
+#define SEQUENCE_MAX_NODES   1024
+#define SEQUENCE_EDGE_SLOTS  2048     // Power of two, twice the nodes so probes stay short
+#define SEQUENCE_LABEL_POOL  16384    // Bytes of action names
+#define SEQUENCE_LINE_LENGTH 512
+
+typedef struct {
+    uint32_t keysym;
+    uint16_t parent;                  // Node the edge leaves
+    uint16_t child;                   // 0 while the slot is free; the root is never a child
+    uint8_t kinds;                    // modifier_kinds() of the stroke
+} SequenceEdge;
+
+typedef struct {
+    int32_t label;                    // Offset of the action name in sequence_labels, -1 for none
+    uint16_t label_len;
+    uint16_t children;                // Edges leaving this node
+} SequenceNode;
+
+static const char *sequence_path = NULL;     // Sequence definitions (--sequences)
+static unsigned int sequence_timeout = 1000; // Milliseconds between strokes (--sequence-timeout)
+static SequenceNode sequence_nodes[SEQUENCE_MAX_NODES];
+static int sequence_node_count = 0;          // Root included; 0 while no file is loaded
+static SequenceEdge sequence_edges[SEQUENCE_EDGE_SLOTS];
+static char sequence_labels[SEQUENCE_LABEL_POOL];
+static size_t sequence_labels_used = 0;
+static int sequence_timer_fd = -1;           // Fires when a sequence in progress times out
+
+// Render thread side of the matcher
+static int sequence_node = 0;                // Node reached so far, 0 at the root
+static uint32_t sequence_time = 0;           // Server time of the last stroke
+static int sequence_source = 0;              // Display the sequence is being typed on
+static char sequence_held_message[MAX_FRAME_MESSAGE]; // Last stroke, drawn if the sequence times out
+static uint64_t sequence_held_key = 0;       // Its repeat key
+
 // Function prototypes
 void disable_cursor(void);
 void enable_cursor(void);
 void get_terminal_size(int *rows, int *cols);
 void print_centered(const char *message);
+void frame_append(const char *data, size_t len);
+void frame_send(void);
+void frame_write(void);
+void render_current_message(void);
+void render_repeat_counter(void);
+void history_push(void);
+const HistoryEntry *history_entry(unsigned int age);
+int history_fade_level(unsigned int age);
+void history_draw_entry(unsigned int age, int top_row);
+void history_render(int message_row, int cleared);
+void frame_append_text(const char *text, int len);
+int format_repeat_counter(char *counter, size_t size);
+void frame_append_spaces(int count);
+int display_width(const char *text, int len);
+int probe_sync_output(void);
 const char *color_name_to_code(const char *color_name, int is_background);
+void compile_color_phases(void);
 const char *mouse_button_to_name(int button);
-const char *keysym_to_string(KeySym keysym);
+const char *keysym_to_string(KeySym keysym, size_t *len);
+uint32_t keysym_hash(uint32_t keysym, uint32_t seed);
+void build_key_label_table(CaptureSource *source);
+void fill_key_label(KeyLabel *key, KeySym keysym);
+void handle_control_events(CaptureSource *source);
 void print_usage(const char *prog_name);
 void event_callback(XPointer priv, XRecordInterceptData *data);
-void update_modifier_state(KeySym keysym, int is_key_press);
+void process_intercept(CaptureSource *source, const XRecordInterceptData *data);
+int decode_event(CaptureSource *source, const xEvent *event, uint32_t server_time, EventRecord *record);
+void queue_records(const EventRecord *records, size_t count);
+int decode_input(CaptureSource *source, int event_type, uint8_t detail, uint32_t time, EventRecord *record);
+int xrecord_open_source(CaptureSource *source);
+int xrecord_open(void);
+void xrecord_dispatch(void *handle, uint32_t events);
+void xrecord_drop_source(CaptureSource *source);
+void xrecord_close(void);
+int evdev_open(void);
+int evdev_add_device(const char *path, int required);
+void evdev_dispatch(void *handle, uint32_t events);
+void evdev_close(void);
+void build_evdev_key_label_table(CaptureSource *source);
+int bus_map(const char *name, int create);
+void bus_unmap(void);
+void bus_publish(const EventRecord *records, size_t count);
+int bus_open(void);
+void bus_dispatch(void *handle, uint32_t events);
+void bus_close(void);
+void *bus_reader_main(void *arg);
+size_t bus_read(uint64_t *next, EventRecord *records, size_t max);
+void put_u16(unsigned char *p, uint16_t value);
+void put_u32(unsigned char *p, uint32_t value);
+int stream_open(const char *addr);
+void stream_close(void);
+void stream_append(const EventRecord *records, size_t count);
+void stream_flush(void);
+void stream_send_labels(void);
+void stream_send(size_t len);
+void stream_begin_packet(int kind);
+void handle_stream_fd(void);
+void handle_stream_timer(void);
+int evdev_decode(const struct input_event *event, EventRecord *records);
+void update_modifier_state(CaptureSource *source, ModifierState modifier_bit, int is_key_press);
+int filter_key_event(uint8_t keycode, ModifierState modifier_bit, ModifierState modifiers);
+int filter_record(const EventRecord *record);
+int parse_modifier_list(const char *list, ModifierState *mask);
+int parse_keycode_range(const char *range, int *first, int *last);
+ModifierState keysym_to_modifier_bit(KeySym keysym);
+const ModifierPrefix *modifier_prefix(ModifierState mask);
+int setup_event_loop(void);
+void run_event_loop(void);
+void handle_signal_fd(void);
+void handle_timer_fd(void);
+int ring_push(const EventRecord *record);
+size_t ring_push_batch(const EventRecord *records, size_t count);
+int ring_pop(EventRecord *record);
+void wake_render_thread(void);
+void *render_thread_main(void *arg);
+void collect_pending_records(void);
+void flush_pending_frame(void);
+int format_record(const EventRecord *record, char *message);
+const KeyLabel *record_key_label(const EventRecord *record);
+uint64_t record_repeat_key(const EventRecord *record);
+uint8_t modifier_kinds(ModifierState mask);
+KeySym keysym_from_name(const char *name, size_t len);
+int sequence_load(const char *path);
+int sequence_add(const char *label, size_t label_len, char *strokes, const char *path, int line);
+int sequence_child(int node, uint8_t kinds, uint32_t keysym);
+int sequence_add_child(int node, uint8_t kinds, uint32_t keysym);
+int sequence_advance(const EventRecord *record, char *message, uint64_t *key);
+void sequence_label_message(int node, int source, char *message, uint64_t *key);
+void sequence_arm_timer(unsigned int ms);
+void sequence_expire(void);
+void sequence_break(void);
+int log_open(const char *path);
+void log_append(const EventRecord *record);
+int log_map_chunk(off_t offset);
+void log_close(void);
+int start_render_thread(void);
+void stop_render_thread(void);
+int ring_full(void);
+int replay_log(const char *path);
+void poll_replay_fds(int timeout_ms);
+void stat_add(atomic_ulong *counter, unsigned long n);
+int latency_bucket(uint64_t us);
+uint64_t latency_bucket_floor(int bucket);
+void stats_record_latency(uint32_t server_time);
+void dump_stats(void);
+void key_stats_add(const EventRecord *record);
+int key_stats_open(void);
+void key_stats_close(void);
+void *key_stats_main(void *arg);
+int key_stats_write(const char *path);
+void key_stats_put_text(FILE *out, const char *text, size_t len, int json);
+void key_stats_put_modifiers(FILE *out, ModifierState mask, int json);
+void print_key_heatmap(FILE *out);
 void cleanup(void);
+uint64_t monotonic_ns(void);
+#ifdef TERMKEY_TRACE
+int trace_open(const char *path);
+void trace_close(void);
+void trace_register(const char *name);
+void trace_event(const char *name, char phase);
+void trace_write_half(TraceBuffer *buffer, int half);
+void *trace_flush_main(void *arg);
+#endif
+#if defined(TERMKEY_BENCH) || defined(TERMKEY_ALLOC_CHECK)
+void note_allocation(size_t size);
+#endif
+#ifdef TERMKEY_BENCH
+int run_benchmarks(void);
+struct BenchScenario;
+unsigned long run_benchmark_scenario(const struct BenchScenario *scenario, int colour);
+int start_latency_bench(size_t events);
+void *latency_bench_main(void *arg);
+void latency_bench_seen(EventRecord *record);
+void latency_bench_collected(const EventRecord *record);
+void latency_bench_written(void);
+int compare_u64(const void *a, const void *b);
+void latency_inject_run(Display *dpy, size_t first, size_t count, unsigned int rate);
+size_t latency_collect(size_t first, size_t count, const uint64_t *end_times, size_t ended, uint64_t *out);
+void latency_report(const char *stage, const uint64_t *sorted, size_t n, size_t expected);
+#endif
+
+static const InputSource xrecord_source = {xrecord_open, xrecord_dispatch, xrecord_close};
+static const InputSource evdev_source = {evdev_open, evdev_dispatch, evdev_close};
+static const InputSource bus_source = {bus_open, bus_dispatch, bus_close};
+static const InputSource *input_source = &xrecord_source; // Backend chosen on the command line
 
 // Main function
 int main(int argc, char *argv[]) {
@@ -156,6 +762,209 @@ int main(int argc, char *argv[]) {
                 fprintf(stderr, "Invalid color name(s) provided.\n");
                 exit(EXIT_FAILURE);
             }
+            compile_color_phases();
+        } else if (strcmp(argv[i], "--wakeups") == 0) {
+            show_wakeups = 1;
+        } else if (strcmp(argv[i], "--frame-bytes") == 0) {
+            show_frame_bytes = 1;
+        } else if (strcmp(argv[i], "--ring-stats") == 0) {
+            show_ring_stats = 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats_at_exit = 1;
+        } else if (strcmp(argv[i], "--stats-file") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--stats-file needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            stats_path = argv[i + 1];
+            stats_at_exit = 1;
+            i += 1; // Skip the file name
+        } else if (strcmp(argv[i], "--sync") == 0) {
+            sync_output = 1;
+        } else if (strcmp(argv[i], "--log") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--log needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            log_path = argv[i + 1];
+            i += 1; // Skip the file name
+        } else if (strcmp(argv[i], "--replay") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--replay needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            replay_path = argv[i + 1];
+            i += 1; // Skip the file name
+        } else if (strcmp(argv[i], "--replay-fast") == 0) {
+            replay_fast = 1;
+#ifdef TERMKEY_BENCH
+        } else if (strcmp(argv[i], "--bench") == 0) {
+            exit(run_benchmarks() == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+        } else if (strcmp(argv[i], "--latency-bench") == 0) {
+            char *end = NULL;
+            long events = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || events <= 0) {
+                fprintf(stderr, "--latency-bench needs a number of events.\n");
+                exit(EXIT_FAILURE);
+            }
+            latency_bench_events = (size_t)events;
+            repeat_window = 0; // Every injected press must produce its own frame
+            i += 1; // Skip the value
+#endif
+#ifdef TERMKEY_TRACE
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--trace needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            trace_path = argv[i + 1];
+            i += 1; // Skip the file name
+#endif
+        } else if (strcmp(argv[i], "-d") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-d needs a display name.\n");
+                exit(EXIT_FAILURE);
+            }
+            if (source_count == MAX_SOURCES) {
+                fprintf(stderr, "At most %d displays are supported.\n", MAX_SOURCES);
+                exit(EXIT_FAILURE);
+            }
+            sources[source_count++].name = argv[i + 1];
+            i += 1; // Skip the display name
+        } else if (strcmp(argv[i], "--daemon") == 0 || strcmp(argv[i], "--view") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a bus name.\n", argv[i]);
+                exit(EXIT_FAILURE);
+            }
+            if (strchr(argv[i + 1], '/') != NULL || strlen(argv[i + 1]) > BUS_NAME_LENGTH - 10) {
+                fprintf(stderr, "Invalid bus name: %s\n", argv[i + 1]);
+                exit(EXIT_FAILURE);
+            }
+            snprintf(bus_name, sizeof(bus_name), "/termkey-%s", argv[i + 1]);
+            if (strcmp(argv[i], "--daemon") == 0) {
+                bus_publisher = 1;
+                display_enabled = 0; // Viewers do the drawing
+            } else {
+                input_source = &bus_source;
+            }
+            i += 1; // Skip the bus name
+        } else if (strcmp(argv[i], "--stream") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--stream needs an address (udp:host:port or unix:path).\n");
+                exit(EXIT_FAILURE);
+            }
+            stream_addr = argv[i + 1];
+            i += 1; // Skip the address
+        } else if (strcmp(argv[i], "--stream-flush") == 0) {
+            char *end = NULL;
+            long us = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || us < 0 || us > 1000000) {
+                fprintf(stderr, "--stream-flush needs a number of microseconds (0-1000000).\n");
+                exit(EXIT_FAILURE);
+            }
+            stream_flush_us = (unsigned int)us;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--evdev") == 0) {
+            input_source = &evdev_source;
+        } else if (strcmp(argv[i], "--evdev-device") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--evdev-device needs a device path.\n");
+                exit(EXIT_FAILURE);
+            }
+            if (evdev_path_count == MAX_EVDEV_DEVICES) {
+                fprintf(stderr, "At most %d evdev devices are supported.\n", MAX_EVDEV_DEVICES);
+                exit(EXIT_FAILURE);
+            }
+            evdev_paths[evdev_path_count++] = argv[i + 1];
+            input_source = &evdev_source;
+            i += 1; // Skip the device path
+        } else if (strcmp(argv[i], "--no-display") == 0) {
+            display_enabled = 0;
+        } else if (strcmp(argv[i], "--max-fps") == 0) {
+            char *end = NULL;
+            long fps = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || fps < 0 || fps > 1000) {
+                fprintf(stderr, "--max-fps needs a number of frames per second (0-1000).\n");
+                exit(EXIT_FAILURE);
+            }
+            max_fps = (unsigned int)fps;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--history") == 0) {
+            char *end = NULL;
+            long lines = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || lines < 0 || lines > HISTORY_MAX) {
+                fprintf(stderr, "--history needs a number of lines (0-%d).\n", HISTORY_MAX);
+                exit(EXIT_FAILURE);
+            }
+            history_lines = (unsigned int)lines;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--key-stats") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--key-stats needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            key_stats_path = argv[i + 1];
+            key_stats_enabled = 1;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--key-stats-interval") == 0) {
+            char *end = NULL;
+            long seconds = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || seconds < 1 || seconds > 86400) {
+                fprintf(stderr, "--key-stats-interval needs a number of seconds (1-86400).\n");
+                exit(EXIT_FAILURE);
+            }
+            key_stats_interval = (unsigned int)seconds;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--heatmap") == 0) {
+            show_heatmap = 1;
+            key_stats_enabled = 1;
+            stats_at_exit = 1;
+        } else if (strcmp(argv[i], "--only-combos") == 0) {
+            if (i + 1 >= argc || parse_modifier_list(argv[i + 1], &event_filter.require_any) != 0) {
+                fprintf(stderr, "--only-combos needs a list of modifiers such as ctrl,super (ctrl, alt, shift, meta, altgr, super).\n");
+                exit(EXIT_FAILURE);
+            }
+            filter_active = 1;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--exclude-keys") == 0) {
+            int first, last;
+            if (i + 1 >= argc || parse_keycode_range(argv[i + 1], &first, &last) != 0) {
+                fprintf(stderr, "--exclude-keys needs a keycode or a range such as 10-19 (0-255).\n");
+                exit(EXIT_FAILURE);
+            }
+            for (int keycode = first; keycode <= last; keycode++) {
+                event_filter.keys[keycode >> 6] &= ~(1ULL << (keycode & 63));
+            }
+            filter_active = 1;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--mouse-only") == 0) {
+            memset(event_filter.keys, 0, sizeof(event_filter.keys));
+            filter_active = 1;
+        } else if (strcmp(argv[i], "--sequences") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--sequences needs a file name.\n");
+                exit(EXIT_FAILURE);
+            }
+            sequence_path = argv[i + 1];
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--sequence-timeout") == 0) {
+            char *end = NULL;
+            long ms = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || ms < 1 || ms > 60000) {
+                fprintf(stderr, "--sequence-timeout needs a number of milliseconds (1-60000).\n");
+                exit(EXIT_FAILURE);
+            }
+            sequence_timeout = (unsigned int)ms;
+            i += 1; // Skip the value
+        } else if (strcmp(argv[i], "--repeat-window") == 0) {
+            char *end = NULL;
+            long ms = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || *end != '\0' || ms < 0) {
+                fprintf(stderr, "--repeat-window needs a number of milliseconds.\n");
+                exit(EXIT_FAILURE);
+            }
+            repeat_window = (unsigned int)ms;
+            i += 1; // Skip the value
         } else {
             // Unknown option
             fprintf(stderr, "Unknown option: %s\n", argv[i]);
@@ -163,200 +972,1645 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    // Disable the cursor when starting the program
-    disable_cursor();
+    if (sequence_path != NULL && sequence_load(sequence_path) != 0) {
+        exit(EXIT_FAILURE);
+    }
 
-    // Open the connection to the X server
-    display = XOpenDisplay(NULL);
-    if (display == NULL) {
-        fprintf(stderr, "Error opening display.\n");
-        enable_cursor();
+    if (bus_publisher && input_source == &bus_source) {
+        fprintf(stderr, "--daemon and --view cannot be combined.\n");
+        exit(EXIT_FAILURE);
+    }
+    // Only live capture goes through queue_records(), which feeds the stream
+    if (stream_addr != NULL && (input_source == &bus_source || replay_path != NULL)) {
+        fprintf(stderr, "--stream cannot be combined with --view or --replay; stream from the capturing process.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (bus_publisher && bus_map(bus_name, 1) != 0) {
         exit(EXIT_FAILURE);
     }
 
-    record_display = XOpenDisplay(NULL);
-    if (record_display == NULL) {
-        fprintf(stderr, "Error opening display for recording.\n");
-        enable_cursor();
-        XCloseDisplay(display);
+    // Without -d, capture $DISPLAY; with several, tag each message with its display
+    if (source_count > 0 && input_source == &evdev_source) {
+        fprintf(stderr, "-d cannot be combined with the evdev backend.\n");
         exit(EXIT_FAILURE);
     }
+    if (source_count == 0) {
+        source_count = 1;
+    }
+    for (int i = 0; i < MAX_SOURCES; i++) {
+        if (i < source_count && sources[i].name != NULL) {
+            snprintf(sources[i].tag, sizeof(sources[i].tag), "[%s] ", sources[i].name);
+        } else {
+            snprintf(sources[i].tag, sizeof(sources[i].tag), "[#%d] ", i);
+        }
+        sources[i].tag_len = strlen(sources[i].tag);
+    }
+    show_source_tags = source_count > 1;
 
-    // Define the range of events we want to capture (mouse and keyboard)
-    XRecordRange *range = XRecordAllocRange();
-    if (range == NULL) {
-        fprintf(stderr, "Error allocating event range.\n");
+    // Truncating the log is the first thing that changes a file, so it comes
+    // after every check that can reject the command line
+    if (log_path != NULL) {
+        struct stat log_st, replay_st;
+        if (replay_path != NULL && stat(log_path, &log_st) == 0 && stat(replay_path, &replay_st) == 0 &&
+            log_st.st_dev == replay_st.st_dev && log_st.st_ino == replay_st.st_ino) {
+            fprintf(stderr, "--log would overwrite the log given to --replay.\n");
+            exit(EXIT_FAILURE);
+        }
+        if (log_open(log_path) != 0) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Route termination signals through the event loop instead of async handlers
+    if (setup_event_loop() != 0) {
+        fprintf(stderr, "Error setting up event loop.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (stream_addr != NULL && stream_open(stream_addr) != 0) {
         cleanup();
         exit(EXIT_FAILURE);
     }
-    range->device_events.first = KeyPress;
-    range->device_events.last  = ButtonRelease; // Includes mouse events
 
-    XRecordClientSpec clients = XRecordAllClients;
+    // Started after the signals are blocked so the exporter thread inherits the mask
+    if (key_stats_path != NULL && key_stats_open() != 0) {
+        cleanup();
+        exit(EXIT_FAILURE);
+    }
+
+#ifdef TERMKEY_TRACE
+    // Opened after the signals are blocked so the flusher thread inherits the mask
+    if (trace_path != NULL && trace_open(trace_path) != 0) {
+        cleanup();
+        exit(EXIT_FAILURE);
+    }
+    TRACE_THREAD("capture");
+#endif
+
+    // Disable the cursor when starting the program
+    if (display_enabled) {
+        disable_cursor();
+    }
+
+    // Only wrap frames in synchronized updates if the terminal understands them
+    if (display_enabled && sync_output && !probe_sync_output()) {
+        sync_output = 0;
+    }
+
+    // Replaying a log needs no X server at all
+    if (replay_path != NULL) {
+        if (display_enabled) {
+            get_terminal_size(&term_rows, &term_cols);
+            print_centered("Termkey");
+        }
+        if (start_render_thread() != 0) {
+            cleanup();
+            exit(EXIT_FAILURE);
+        }
+        int status = replay_log(replay_path);
+        stop_render_thread();
+        cleanup();
+        return status == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
 
-    // Create the recording context to capture events
-    XRecordContext context = XRecordCreateContext(record_display, 0, &clients, 1, &range, 1);
-    if (!context) {
-        fprintf(stderr, "Error creating recording context.\n");
-        XFree(range);
+#ifdef TERMKEY_BENCH
+    // XTest input goes through the X server, never through evdev
+    if (latency_bench_events > 0 && (input_source != &xrecord_source || source_count > 1)) {
+        fprintf(stderr, "--latency-bench needs the XRecord backend and a single display.\n");
         cleanup();
         exit(EXIT_FAILURE);
     }
+#endif
 
-    // Enable the recording context asynchronously
-    if (!XRecordEnableContextAsync(record_display, context, event_callback, NULL)) {
-        fprintf(stderr, "Error enabling recording context.\n");
-        XRecordFreeContext(record_display, context);
-        XFree(range);
+    // Start capturing from the selected backend
+    if (input_source->open() != 0) {
         cleanup();
         exit(EXIT_FAILURE);
     }
 
     // Display "Termkey" at startup
-    print_centered("Termkey");
+    if (display_enabled) {
+        get_terminal_size(&term_rows, &term_cols);
+        print_centered("Termkey");
+    }
+
+    // From here on only the render thread writes to the terminal
+    if (start_render_thread() != 0) {
+        cleanup();
+        exit(EXIT_FAILURE);
+    }
 
-    // Infinite loop to process events
-    while (1) {
-        XRecordProcessReplies(record_display);
-        usleep(10000);  // Small pause to avoid high CPU load
+#ifdef TERMKEY_BENCH
+    // The injector thread stops the loop with SIGTERM once it has its numbers
+    if (latency_bench_events > 0 && start_latency_bench(latency_bench_events) != 0) {
+        stop_render_thread();
+        cleanup();
+        exit(EXIT_FAILURE);
     }
+#endif
+
+    // Block until an input device, a signal or the timer needs attention
+    run_event_loop();
 
-    // Cleanup resources (unreachable code in current state)
-    // To make the code more robust, you might want to handle signals to allow graceful exit.
-    // For now, we can leave this here for completeness.
-    XRecordDisableContext(record_display, context);
-    XRecordFreeContext(record_display, context);
-    XFree(range);
+    // Let the render thread finish its last frame before restoring the terminal
+    stop_render_thread();
+
+    // Cleanup resources once a termination signal has stopped the loop
     cleanup();
 
     return 0;
 }
 
-// Function to get terminal size
-void get_terminal_size(int *rows, int *cols) {
-    struct winsize ws;
-    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != -1) {
-        *rows = ws.ws_row;
-        *cols = ws.ws_col;
-    } else {
-        *rows = 24; // Default rows
-        *cols = 80; // Default columns
+// Function to create the epoll set with the signal and timer descriptors
+int setup_event_loop(void) {
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGWINCH);
+    sigaddset(&mask, SIGUSR1);
+
+    // Signals must be blocked so they are only delivered through the signalfd
+    if (sigprocmask(SIG_BLOCK, &mask, NULL) == -1) {
+        perror("sigprocmask");
+        return -1;
     }
-}
 
-// Function to disable the cursor
-void disable_cursor(void) {
-    printf("\033[?25l");  // Hides the cursor
-    fflush(stdout);
-}
+    signal_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signal_fd == -1) {
+        perror("signalfd");
+        return -1;
+    }
 
-// Function to enable the cursor
-void enable_cursor(void) {
-    printf("\033[?25h");  // Shows the cursor
-    fflush(stdout);
-}
+    render_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (render_wake_fd == -1) {
+        perror("eventfd");
+        return -1;
+    }
 
-// Function to map color names to ANSI codes
-const char *color_name_to_code(const char *color_name, int is_background) {
-    static const struct {
-        const char *name;
-        const char *code_fg;
-        const char *code_bg;
-    } color_table[] = {
-        {"black",   "\033[30m", "\033[40m"},
-        {"red",     "\033[31m", "\033[41m"},
-        {"green",   "\033[32m", "\033[42m"},
-        {"yellow",  "\033[33m", "\033[43m"},
-        {"blue",    "\033[34m", "\033[44m"},
-        {"magenta", "\033[35m", "\033[45m"},
-        {"cyan",    "\033[36m", "\033[46m"},
-        {"white",   "\033[37m", "\033[47m"},
-        {"default", "\033[39m", "\033[49m"},
-        {NULL,      NULL,       NULL}
-    };
+    render_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (render_timer_fd == -1) {
+        perror("timerfd_create");
+        return -1;
+    }
 
-    for (int i = 0; color_table[i].name != NULL; i++) {
-        if (strcmp(color_name, color_table[i].name) == 0) {
-            return is_background ? color_table[i].code_bg : color_table[i].code_fg;
+    if (sequence_node_count > 0) {
+        sequence_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (sequence_timer_fd == -1) {
+            perror("timerfd_create");
+            return -1;
         }
     }
-    return NULL; // Invalid color
-}
-
-// Function to print centered text in the terminal
-void print_centered(const char *message) {
-    int rows, cols;
-    static int color_toggle = 0;  // Static variable to keep track of color toggling
-
-    get_terminal_size(&rows, &cols);
 
-    int len = (int)strlen(message);
-    int x = (cols - len) / 2;
-    int y = rows / 2;
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer_fd == -1) {
+        perror("timerfd_create");
+        return -1;
+    }
 
-    // Clear the screen
-    printf("\033[H\033[J");  // Clears the screen
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd == -1) {
+        perror("epoll_create1");
+        return -1;
+    }
 
-    // Move the cursor to the position
-    printf("\033[%d;%dH", y, x + 1); // +1 for 1-based indexing in terminals
+    // Every registration carries a pointer; the loop's own fds point at their variables
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN;
+    ev.data.ptr = &signal_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, signal_fd, &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    ev.data.ptr = &timer_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
 
-    // Check if color function is activated
-    if (use_color) {
-        const char *bg_color_code = NULL;
-        const char *fg_color_code = NULL;
-        const char *letter_color_code = NULL;
-
-        if (color_toggle) {
-            // Swap background and foreground colors to create blinking effect
-            bg_color_code = color_name_to_code(fg_color_name, 1);
-            fg_color_code = color_name_to_code(bg_color_name, 0);
-        } else {
-            bg_color_code = color_name_to_code(bg_color_name, 1);
-            fg_color_code = color_name_to_code(fg_color_name, 0);
-        }
+    // The timer only runs when there is something periodic to do,
+    // so an idle termkey never wakes up on its own
+    if (show_wakeups || show_frame_bytes || show_ring_stats) {
+        struct itimerspec its = {{1, 0}, {1, 0}};
+        timerfd_settime(timer_fd, 0, &its, NULL);
+    }
 
-        // Get letter color code if provided
-        if (letter_color_name[0] != '\0') {
-            letter_color_code = color_name_to_code(letter_color_name, 0);
-        }
+    return 0;
+}
 
-        // Apply background color if valid
-        if (bg_color_code) {
-            printf("%s", bg_color_code);
+// Function to wait for events and dispatch them until told to stop
+void run_event_loop(void) {
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    while (running) {
+        int n = epoll_wait(epoll_fd, events, MAX_EPOLL_EVENTS, -1);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait");
+            break;
         }
+        stat_add(&loop_wakeups, 1);
 
-        // Now print each character
-        for (int i = 0; i < len; i++) {
-            char c = message[i];
-
-            if (isgraph((unsigned char)c) && letter_color_code) {
-                // Apply letter color to all printable characters
-                printf("%s", letter_color_code);
-            } else if (fg_color_code) {
-                // Apply foreground color
-                printf("%s", fg_color_code);
+        for (int i = 0; i < n && running; i++) {
+            void *handle = events[i].data.ptr;
+            if (handle == &signal_fd) {
+                handle_signal_fd();
+            } else if (handle == &timer_fd) {
+                handle_timer_fd();
+            } else if (handle == &stream_fd) {
+                handle_stream_fd();
+            } else if (handle == &stream_timer_fd) {
+                handle_stream_timer();
             } else {
-                // Reset to default foreground color
-                printf("\033[39m");
+                input_source->dispatch(handle, events[i].events);
             }
-
-            // Print the character
-            printf("%c", c);
         }
+    }
+}
 
-        // Toggle color for next time
-        color_toggle = !color_toggle;
+// Function to start recording on every display named with -d
+int xrecord_open(void) {
+    for (int i = 0; i < source_count; i++) {
+        if (xrecord_open_source(&sources[i]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
 
-        // Reset attributes
-        printf("\033[0m\n");
+// Function to connect to one X server, build its key table and enable recording
+int xrecord_open_source(CaptureSource *source) {
+    const char *name = source->name != NULL ? source->name : XDisplayName(NULL);
 
-    } else {
-        // No color, simply print the message
-        printf("%s\n", message);
+    // Open the control connection to the X server
+    source->display = XOpenDisplay(source->name);
+    if (source->display == NULL) {
+        fprintf(stderr, "Error opening display %s.\n", name);
+        return -1;
     }
 
-    fflush(stdout);  // Ensures the text is displayed immediately
-}
+    // Resolve every keycode once and ask to be told when the keymap changes
+    int xkb_major = XkbMajorVersion, xkb_minor = XkbMinorVersion;
+    if (!XkbQueryExtension(source->display, NULL, &source->xkb_event_base, NULL, &xkb_major, &xkb_minor)) {
+        fprintf(stderr, "XKB extension not available on %s.\n", name);
+        return -1;
+    }
+    XkbSelectEvents(source->display, XkbUseCoreKbd,
+                    XkbMapNotifyMask | XkbNewKeyboardNotifyMask,
+                    XkbMapNotifyMask | XkbNewKeyboardNotifyMask);
+    build_key_label_table(source);
+
+    // Define the range of events we want to capture (mouse and keyboard)
+    source->record_range = XRecordAllocRange();
+    if (source->record_range == NULL) {
+        fprintf(stderr, "Error allocating event range.\n");
+        return -1;
+    }
+    source->record_range->device_events.first = KeyPress;
+    source->record_range->device_events.last  = ButtonRelease; // Includes mouse events
+
+    XRecordClientSpec clients = XRecordAllClients;
+
+    // Create the recording context to capture events; the server must know it
+    // before the data connection can enable it
+    source->record_context = XRecordCreateContext(source->display, 0, &clients, 1, &source->record_range, 1);
+    if (!source->record_context) {
+        fprintf(stderr, "Error creating recording context on %s.\n", name);
+        return -1;
+    }
+    XSync(source->display, False);
+
+    source->record_display = XOpenDisplay(source->name);
+    if (source->record_display == NULL) {
+        fprintf(stderr, "Error opening display %s for recording.\n", name);
+        return -1;
+    }
+
+    // Enable the recording context asynchronously; the callback gets the source back
+    if (!XRecordEnableContextAsync(source->record_display, source->record_context,
+                                   event_callback, (XPointer)source)) {
+        fprintf(stderr, "Error enabling recording context on %s.\n", name);
+        return -1;
+    }
+    source->record_enabled = 1;
+
+    // Each connection is registered with the address of its Display pointer,
+    // which tells the dispatcher both the source and which connection it is
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = &source->record_display;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, ConnectionNumber(source->record_display), &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    ev.data.ptr = &source->display;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, ConnectionNumber(source->display), &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    sources_live++;
+
+    // Drain anything that arrived while the context was being enabled
+    TRACE_BEGIN("XRecordProcessReplies");
+    XRecordProcessReplies(source->record_display);
+    TRACE_END("XRecordProcessReplies");
+    wake_render_thread();
+    handle_control_events(source);
+    return 0;
+}
+
+// Function to handle readiness of one display's data or control connection
+void xrecord_dispatch(void *handle, uint32_t events) {
+    Display **connection = handle;
+    CaptureSource *source = &sources[((char *)connection - (char *)sources) / sizeof(CaptureSource)];
+    if (*connection == NULL) {
+        return; // Dropped earlier in this wakeup through its other connection
+    }
+
+    if (events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) {
+        xrecord_drop_source(source);
+    } else if (connection == &source->record_display) {
+        TRACE_BEGIN("XRecordProcessReplies");
+        XRecordProcessReplies(source->record_display);
+        TRACE_END("XRecordProcessReplies");
+        wake_render_thread();
+    } else {
+        handle_control_events(source);
+    }
+}
+
+// Function to stop capturing a display whose server has gone away, and the
+// whole loop once none is left. Xlib treats any request on a dead connection
+// as fatal, so the Displays are not closed through it: the sockets are taken
+// out of epoll and closed, and the Display structures are abandoned
+void xrecord_drop_source(CaptureSource *source) {
+    fprintf(stderr, "Lost connection to the X server %s.\n",
+            source->name != NULL ? source->name : XDisplayName(NULL));
+
+    Display *connections[2] = {source->record_display, source->display};
+    for (int i = 0; i < 2; i++) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, ConnectionNumber(connections[i]), NULL);
+        close(ConnectionNumber(connections[i]));
+    }
+    source->record_display = NULL;
+    source->display = NULL;
+    source->record_enabled = 0;
+    source->record_context = 0;
+    source->modifiers = 0;
+    source->mouse_button_pressed = 0;
+
+    if (--sources_live == 0) {
+        running = 0;
+    }
+}
+
+// Function to disable and free every recording context; safe to call if never opened
+void xrecord_close(void) {
+    for (int i = 0; i < source_count; i++) {
+        CaptureSource *source = &sources[i];
+        if (source->display != NULL && source->record_context) {
+            if (source->record_enabled) {
+                XRecordDisableContext(source->display, source->record_context);
+                source->record_enabled = 0;
+            }
+            XRecordFreeContext(source->display, source->record_context);
+            source->record_context = 0;
+        }
+        if (source->record_range != NULL) {
+            XFree(source->record_range);
+            source->record_range = NULL;
+        }
+    }
+}
+
+// US layout for the evdev backend, which has no X server to ask. X keycodes
+// are evdev codes plus 8, as in the xkb evdev rules.
+static const struct {
+    uint16_t code;
+    KeySym keysym;
+} evdev_keymap[] = {
+    {KEY_ESC, XK_Escape}, {KEY_1, XK_1}, {KEY_2, XK_2}, {KEY_3, XK_3}, {KEY_4, XK_4},
+    {KEY_5, XK_5}, {KEY_6, XK_6}, {KEY_7, XK_7}, {KEY_8, XK_8}, {KEY_9, XK_9}, {KEY_0, XK_0},
+    {KEY_MINUS, XK_minus}, {KEY_EQUAL, XK_equal}, {KEY_BACKSPACE, XK_BackSpace}, {KEY_TAB, XK_Tab},
+    {KEY_Q, XK_q}, {KEY_W, XK_w}, {KEY_E, XK_e}, {KEY_R, XK_r}, {KEY_T, XK_t},
+    {KEY_Y, XK_y}, {KEY_U, XK_u}, {KEY_I, XK_i}, {KEY_O, XK_o}, {KEY_P, XK_p},
+    {KEY_LEFTBRACE, XK_bracketleft}, {KEY_RIGHTBRACE, XK_bracketright}, {KEY_ENTER, XK_Return},
+    {KEY_LEFTCTRL, XK_Control_L},
+    {KEY_A, XK_a}, {KEY_S, XK_s}, {KEY_D, XK_d}, {KEY_F, XK_f}, {KEY_G, XK_g},
+    {KEY_H, XK_h}, {KEY_J, XK_j}, {KEY_K, XK_k}, {KEY_L, XK_l},
+    {KEY_SEMICOLON, XK_semicolon}, {KEY_APOSTROPHE, XK_apostrophe}, {KEY_GRAVE, XK_grave},
+    {KEY_LEFTSHIFT, XK_Shift_L}, {KEY_BACKSLASH, XK_backslash},
+    {KEY_Z, XK_z}, {KEY_X, XK_x}, {KEY_C, XK_c}, {KEY_V, XK_v}, {KEY_B, XK_b},
+    {KEY_N, XK_n}, {KEY_M, XK_m},
+    {KEY_COMMA, XK_comma}, {KEY_DOT, XK_period}, {KEY_SLASH, XK_slash}, {KEY_RIGHTSHIFT, XK_Shift_R},
+    {KEY_KPASTERISK, XK_KP_Multiply}, {KEY_LEFTALT, XK_Alt_L}, {KEY_SPACE, XK_space},
+    {KEY_CAPSLOCK, XK_Caps_Lock},
+    {KEY_F1, XK_F1}, {KEY_F2, XK_F2}, {KEY_F3, XK_F3}, {KEY_F4, XK_F4}, {KEY_F5, XK_F5},
+    {KEY_F6, XK_F6}, {KEY_F7, XK_F7}, {KEY_F8, XK_F8}, {KEY_F9, XK_F9}, {KEY_F10, XK_F10},
+    {KEY_NUMLOCK, XK_Num_Lock}, {KEY_SCROLLLOCK, XK_Scroll_Lock},
+    {KEY_KP7, XK_KP_Home}, {KEY_KP8, XK_KP_Up}, {KEY_KP9, XK_KP_Prior}, {KEY_KPMINUS, XK_KP_Subtract},
+    {KEY_KP4, XK_KP_Left}, {KEY_KP5, XK_KP_Begin}, {KEY_KP6, XK_KP_Right}, {KEY_KPPLUS, XK_KP_Add},
+    {KEY_KP1, XK_KP_End}, {KEY_KP2, XK_KP_Down}, {KEY_KP3, XK_KP_Next},
+    {KEY_KP0, XK_KP_Insert}, {KEY_KPDOT, XK_KP_Delete},
+    {KEY_102ND, XK_less}, {KEY_F11, XK_F11}, {KEY_F12, XK_F12},
+    {KEY_KPENTER, XK_KP_Enter}, {KEY_RIGHTCTRL, XK_Control_R}, {KEY_KPSLASH, XK_KP_Divide},
+    {KEY_SYSRQ, XK_Print}, {KEY_RIGHTALT, XK_ISO_Level3_Shift},
+    {KEY_HOME, XK_Home}, {KEY_UP, XK_Up}, {KEY_PAGEUP, XK_Page_Up}, {KEY_LEFT, XK_Left},
+    {KEY_RIGHT, XK_Right}, {KEY_END, XK_End}, {KEY_DOWN, XK_Down}, {KEY_PAGEDOWN, XK_Page_Down},
+    {KEY_INSERT, XK_Insert}, {KEY_DELETE, XK_Delete}, {KEY_PAUSE, XK_Pause},
+    {KEY_LEFTMETA, XK_Super_L}, {KEY_RIGHTMETA, XK_Super_R}, {KEY_COMPOSE, XK_Menu}
+};
+
+#define EVDEV_KEYMAP_SIZE (sizeof(evdev_keymap) / sizeof(evdev_keymap[0]))
+
+// Function to fill the key table from the built-in evdev keymap
+void build_evdev_key_label_table(CaptureSource *source) {
+    memset(source->key_labels, 0, sizeof(source->key_labels));
+    for (size_t i = 0; i < EVDEV_KEYMAP_SIZE; i++) {
+        fill_key_label(&source->key_labels[evdev_keymap[i].code + 8], evdev_keymap[i].keysym);
+    }
+    stream_labels_dirty = 1;
+}
+
+// Function to open the evdev devices and add them to the epoll set
+int evdev_open(void) {
+    build_evdev_key_label_table(&sources[0]);
+
+    if (evdev_path_count > 0) {
+        for (int i = 0; i < evdev_path_count; i++) {
+            if (evdev_add_device(evdev_paths[i], 1) != 0) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    // No devices named: take everything that reports keys or buttons
+    DIR *dir = opendir("/dev/input");
+    if (dir == NULL) {
+        perror("/dev/input");
+        return -1;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL && evdev_count < MAX_EVDEV_DEVICES) {
+        if (strncmp(entry->d_name, "event", 5) == 0) {
+            char path[280];
+            snprintf(path, sizeof(path), "/dev/input/%s", entry->d_name);
+            evdev_add_device(path, 0);
+        }
+    }
+    closedir(dir);
+
+    if (evdev_count == 0) {
+        fprintf(stderr, "No readable keyboard or pointer in /dev/input (is this user in the input group?).\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to open one device; errors are only reported for named devices
+int evdev_add_device(const char *path, int required) {
+    int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd == -1) {
+        if (required) {
+            perror(path);
+        }
+        return -1;
+    }
+
+    // Skip devices that never send keys or buttons, such as accelerometers
+    unsigned long types = 0;
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(types)), &types) == -1 || !(types & (1UL << EV_KEY))) {
+        if (required) {
+            fprintf(stderr, "%s does not report keys or buttons.\n", path);
+        }
+        close(fd);
+        return -1;
+    }
+
+    // Timestamps on the same clock as the latency histogram expects
+    int clock = CLOCK_MONOTONIC;
+    ioctl(fd, EVIOCSCLOCKID, &clock);
+
+    // Registered with its slot; slots are never reused, so a stale event finds -1 in it
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN;
+    ev.data.ptr = &evdev_fds[evdev_count];
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        perror("epoll_ctl");
+        close(fd);
+        return -1;
+    }
+
+    evdev_fds[evdev_count++] = fd;
+    return 0;
+}
+
+// Function to read everything a device has queued and decode it as one batch
+void evdev_dispatch(void *handle, uint32_t events) {
+    (void)events; // A hung-up device fails the read below
+    int *slot = handle;
+    int fd = *slot;
+    if (fd == -1) {
+        return; // Unplugged earlier in this wakeup
+    }
+    struct input_event input[EVDEV_READ_EVENTS];
+    EventRecord batch[EVDEV_READ_EVENTS * 2];  // A wheel step becomes a press and a release
+
+    for (;;) {
+        ssize_t n = read(fd, input, sizeof(input));
+        if (n <= 0) {
+            if (n == -1 && (errno == EAGAIN || errno == EINTR)) {
+                break;
+            }
+
+            // Unplugged: forget the device and keep going with the others
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+            close(fd);
+            *slot = -1;
+            break;
+        }
+
+        ALLOC_SCOPE_BEGIN("evdev_dispatch");
+        size_t count = (size_t)n / sizeof(input[0]);
+        size_t batched = 0;
+        for (size_t i = 0; i < count; i++) {
+            batched += evdev_decode(&input[i], &batch[batched]);
+        }
+        if (batched > 0) {
+            queue_records(batch, batched);
+        }
+        ALLOC_SCOPE_END();
+        if (count < EVDEV_READ_EVENTS) {
+            break;
+        }
+    }
+
+    wake_render_thread();
+}
+
+// Function to turn one input_event into X-style records, returning how many
+int evdev_decode(const struct input_event *event, EventRecord *records) {
+    uint32_t time = (uint32_t)event->input_event_sec * 1000 + (uint32_t)event->input_event_usec / 1000;
+
+    if (event->type == EV_KEY) {
+        // Autorepeat (value 2) is a press again, as X reports it
+        int type = event->value ? KeyPress : KeyRelease;
+        int button = 0;
+        switch (event->code) {
+            case BTN_LEFT:   button = 1; break;
+            case BTN_MIDDLE: button = 2; break;
+            case BTN_RIGHT:  button = 3; break;
+            case BTN_SIDE:   button = 8; break;
+            case BTN_EXTRA:  button = 9; break;
+        }
+        if (button != 0) {
+            if (event->value == 2) {
+                return 0;
+            }
+            return decode_input(&sources[0], event->value ? ButtonPress : ButtonRelease, (uint8_t)button, time, records);
+        }
+        if (event->code + 8 >= MAX_KEYCODES) {
+            return 0;
+        }
+        return decode_input(&sources[0], type, (uint8_t)(event->code + 8), time, records);
+    }
+
+    // Wheel steps are buttons 4-7 in X, pressed and released at once
+    if (event->type == EV_REL && (event->code == REL_WHEEL || event->code == REL_HWHEEL) && event->value != 0) {
+        uint8_t button;
+        if (event->code == REL_WHEEL) {
+            button = event->value > 0 ? 4 : 5;
+        } else {
+            button = event->value > 0 ? 7 : 6;
+        }
+        int produced = decode_input(&sources[0], ButtonPress, button, time, &records[0]);
+        produced += decode_input(&sources[0], ButtonRelease, button, time, &records[produced]);
+        return produced;
+    }
+    return 0;
+}
+
+// Function to close every evdev device
+void evdev_close(void) {
+    for (int i = 0; i < evdev_count; i++) {
+        if (evdev_fds[i] != -1) {
+            close(evdev_fds[i]);
+        }
+    }
+    evdev_count = 0;
+}
+
+// Function to create (for --daemon) or open (for --view) the shared-memory bus
+int bus_map(const char *name, int create) {
+    // Records are keystrokes, passwords included, so only the owner may map the bus
+    int fd = shm_open(name, create ? O_RDWR | O_CREAT : O_RDWR, 0600);
+    if (fd == -1) {
+        if (!create && errno == ENOENT) {
+            fprintf(stderr, "No event bus %s; start termkey --daemon first.\n", name + 9);
+        } else {
+            perror(name);
+        }
+        return -1;
+    }
+    if (create && (fchmod(fd, 0600) == -1 || ftruncate(fd, sizeof(EventBus)) == -1)) {
+        perror(name);
+        close(fd);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(EventBus)) {
+        fprintf(stderr, "Event bus %s has the wrong size.\n", name);
+        close(fd);
+        return -1;
+    }
+
+    void *map = mmap(NULL, sizeof(EventBus), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    bus = map;
+
+    int compatible = memcmp(bus->magic, BUS_MAGIC, sizeof(BUS_MAGIC)) == 0 &&
+                     bus->version == BUS_VERSION && bus->record_size == sizeof(EventRecord) &&
+                     bus->slot_count == BUS_SLOTS;
+    if (create && !compatible) {
+        // A new or older bus: lay it out afresh. A restarted daemon keeps the
+        // sequence of a compatible one so attached viewers carry on.
+        memset(bus, 0, sizeof(EventBus));
+        memcpy(bus->magic, BUS_MAGIC, sizeof(BUS_MAGIC));
+        bus->version = BUS_VERSION;
+        bus->record_size = sizeof(EventRecord);
+        bus->slot_count = BUS_SLOTS;
+    } else if (!compatible) {
+        fprintf(stderr, "Event bus %s was created by an incompatible termkey.\n", name);
+        bus_unmap();
+        return -1;
+    }
+    return 0;
+}
+
+// Function to unmap the bus. It stays in /dev/shm for the next daemon, but
+// the daemon wipes the records first so no keystrokes outlive it
+void bus_unmap(void) {
+    if (bus != NULL && bus_publisher) {
+        for (size_t i = 0; i < BUS_SLOTS; i++) {
+            atomic_store_explicit(&bus->slots[i].seq, 0, memory_order_relaxed);
+            atomic_store_explicit(&bus->slots[i].data[0], 0, memory_order_relaxed);
+            atomic_store_explicit(&bus->slots[i].data[1], 0, memory_order_relaxed);
+        }
+    }
+    if (bus != NULL) {
+        munmap(bus, sizeof(EventBus));
+        bus = NULL;
+    }
+}
+
+// Function to publish records to the bus and wake any viewers waiting for them
+void bus_publish(const EventRecord *records, size_t count) {
+    uint64_t seq = atomic_load_explicit(&bus->write_seq, memory_order_relaxed);
+
+    for (size_t i = 0; i < count; i++, seq++) {
+        BusSlot *slot = &bus->slots[seq & (BUS_SLOTS - 1)];
+        uint64_t data[2];
+        memcpy(data, &records[i], sizeof(data));
+
+        // Readers that see 0 or a different number know the slot is not theirs
+        atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&slot->data[0], data[0], memory_order_relaxed);
+        atomic_store_explicit(&slot->data[1], data[1], memory_order_relaxed);
+        atomic_store_explicit(&slot->seq, seq + 1, memory_order_release);
+    }
+
+    atomic_store_explicit(&bus->write_seq, seq, memory_order_release);
+    // Sequentially consistent, so this load cannot pass the store a waiter compares against
+    atomic_store(&bus->futex_word, (unsigned int)seq);
+    if (atomic_load(&bus->waiters) > 0) {
+        syscall(SYS_futex, &bus->futex_word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+// Function to attach to the bus and start copying it into the render ring
+int bus_open(void) {
+    if (bus_map(bus_name, 0) != 0) {
+        return -1;
+    }
+
+    bus_reading = 1;
+    bus_reader_done = 0;
+    if (pthread_create(&bus_thread, NULL, bus_reader_main, NULL) != 0) {
+        fprintf(stderr, "Error starting bus reader thread.\n");
+        bus_reading = 0;
+        return -1;
+    }
+    return 0;
+}
+
+// The bus has no descriptors in the epoll set; its reader thread waits on a futex
+void bus_dispatch(void *handle, uint32_t events) {
+    (void)handle;
+    (void)events;
+}
+
+// Function to stop the reader thread; safe to call if bus_open() failed
+void bus_close(void) {
+    if (!bus_reading) {
+        return;
+    }
+    bus_reading = 0;
+
+    // The reader may have checked bus_reading but not yet reached FUTEX_WAIT,
+    // in which case a single wake finds nobody and it sleeps on an unchanged
+    // word. Wake until it has left its loop; the other viewers just wait again
+    const struct timespec retry = {0, 10000000L};
+    while (!bus_reader_done) {
+        syscall(SYS_futex, &bus->futex_word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+        nanosleep(&retry, NULL);
+    }
+    pthread_join(bus_thread, NULL);
+
+    if (bus_overruns > 0) {
+        fprintf(stderr, "bus: %lu records lost while this viewer was behind\n", (unsigned long)bus_overruns);
+    }
+}
+
+// Function to copy up to max records starting at *next, skipping what was overwritten
+size_t bus_read(uint64_t *next, EventRecord *records, size_t max) {
+    uint64_t head = atomic_load_explicit(&bus->write_seq, memory_order_acquire);
+    if (head - *next > BUS_SLOTS) {
+        stat_add(&bus_overruns, head - BUS_SLOTS - *next);
+        *next = head - BUS_SLOTS;
+    }
+
+    size_t n = 0;
+    while (*next < head && n < max) {
+        const BusSlot *slot = &bus->slots[*next & (BUS_SLOTS - 1)];
+        uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        uint64_t data[2];
+        data[0] = atomic_load_explicit(&slot->data[0], memory_order_relaxed);
+        data[1] = atomic_load_explicit(&slot->data[1], memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+
+        if (seq != *next + 1 || atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) {
+            // Overwritten while we read it: the writer is at least a lap ahead
+            stat_add(&bus_overruns, 1);
+            (*next)++;
+            continue;
+        }
+        memcpy(&records[n++], data, sizeof(data));
+        (*next)++;
+    }
+    return n;
+}
+
+// Viewer thread: sleep until the daemon publishes, then feed the render thread
+void *bus_reader_main(void *arg) {
+    (void)arg;
+    EventRecord batch[INTERCEPT_BATCH];
+
+    // Start with what happens from now on, not with whatever is in the ring
+    uint64_t next = atomic_load_explicit(&bus->write_seq, memory_order_acquire);
+
+    while (bus_reading) {
+        unsigned int word = atomic_load_explicit(&bus->futex_word, memory_order_acquire);
+        size_t n = bus_read(&next, batch, INTERCEPT_BATCH);
+
+        if (n == 0) {
+            if ((unsigned int)next != word) {
+                continue; // Published between the two loads
+            }
+            atomic_fetch_add(&bus->waiters, 1);
+            syscall(SYS_futex, &bus->futex_word, FUTEX_WAIT, word, NULL, NULL, 0);
+            atomic_fetch_sub(&bus->waiters, 1);
+            continue;
+        }
+
+        // Records carry their keysyms, so nothing here needs a keymap
+        ALLOC_SCOPE_BEGIN("bus_reader");
+        size_t kept = 0;
+        for (size_t i = 0; i < n; i++) {
+            EventRecord *record = &batch[i];
+            if (record->source >= MAX_SOURCES) {
+                record->source = 0;
+            }
+            if (record->source != 0 && !show_source_tags) {
+                show_source_tags = 1;
+            }
+            if (filter_active && !filter_record(record)) {
+                continue;
+            }
+            if (record->type >= KeyPress && record->type <= ButtonRelease) {
+                stat_add(&event_counts[record->type - KeyPress], 1);
+            }
+            if (key_stats_enabled) {
+                key_stats_add(record);
+            }
+            batch[kept++] = *record;
+        }
+        if (display_enabled && kept > 0) {
+            ring_push_batch(batch, kept);
+            wake_render_thread();
+        }
+        ALLOC_SCOPE_END();
+    }
+    bus_reader_done = 1;
+    return NULL;
+}
+
+// Function to store a little-endian 16-bit value
+void put_u16(unsigned char *p, uint16_t value) {
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8);
+}
+
+// Function to store a little-endian 32-bit value
+void put_u32(unsigned char *p, uint32_t value) {
+    put_u16(p, (uint16_t)value);
+    put_u16(p + 2, (uint16_t)(value >> 16));
+}
+
+// Function to connect the stream socket and add it and its flush timer to epoll
+int stream_open(const char *addr) {
+    if (strncmp(addr, "unix:", 5) == 0) {
+        struct sockaddr_un sun = {0};
+        sun.sun_family = AF_UNIX;
+        if (strlen(addr + 5) >= sizeof(sun.sun_path)) {
+            fprintf(stderr, "Socket path too long: %s\n", addr + 5);
+            return -1;
+        }
+        strcpy(sun.sun_path, addr + 5);
+
+        stream_fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (stream_fd == -1) {
+            perror("socket");
+            return -1;
+        }
+
+        // Autobind to an abstract address so the receiver can send its hello back
+        struct sockaddr_un self = {0};
+        self.sun_family = AF_UNIX;
+        if (bind(stream_fd, (struct sockaddr *)&self, sizeof(sa_family_t)) == -1 ||
+            connect(stream_fd, (struct sockaddr *)&sun, sizeof(sun)) == -1) {
+            perror(addr + 5);
+            return -1;
+        }
+    } else if (strncmp(addr, "udp:", 4) == 0) {
+        // udp:host:port, with IPv6 hosts in brackets
+        char host[256];
+        const char *port = strrchr(addr + 4, ':');
+        size_t host_len = port != NULL ? (size_t)(port - (addr + 4)) : 0;
+        if (port == NULL || host_len == 0 || host_len >= sizeof(host)) {
+            fprintf(stderr, "Invalid stream address: %s\n", addr);
+            return -1;
+        }
+        memcpy(host, addr + 4, host_len);
+        host[host_len] = '\0';
+        if (host[0] == '[' && host[host_len - 1] == ']') {
+            memmove(host, host + 1, host_len - 2);
+            host[host_len - 2] = '\0';
+        }
+
+        struct addrinfo hints = {0}, *result = NULL;
+        hints.ai_socktype = SOCK_DGRAM;
+        int err = getaddrinfo(host, port + 1, &hints, &result);
+        if (err != 0) {
+            fprintf(stderr, "%s: %s\n", addr, gai_strerror(err));
+            return -1;
+        }
+        stream_fd = socket(result->ai_family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (stream_fd == -1 || connect(stream_fd, result->ai_addr, result->ai_addrlen) == -1) {
+            perror(addr);
+            freeaddrinfo(result);
+            return -1;
+        }
+        freeaddrinfo(result);
+    } else {
+        fprintf(stderr, "Stream address must start with udp: or unix:\n");
+        return -1;
+    }
+
+    stream_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (stream_timer_fd == -1) {
+        perror("timerfd_create");
+        return -1;
+    }
+
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN;
+    ev.data.ptr = &stream_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, stream_fd, &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    ev.data.ptr = &stream_timer_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, stream_timer_fd, &ev) == -1) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to send what is pending and close the socket
+void stream_close(void) {
+    if (stream_fd != -1) {
+        stream_flush();
+        close(stream_fd);
+        stream_fd = -1;
+    }
+    if (stream_timer_fd != -1) {
+        close(stream_timer_fd);
+        stream_timer_fd = -1;
+    }
+}
+
+// Function to start a packet: magic, version, kind, generation, count, sequence
+void stream_begin_packet(int kind) {
+    stream_packet[0] = 'T';
+    stream_packet[1] = 'K';
+    stream_packet[2] = STREAM_VERSION;
+    stream_packet[3] = (unsigned char)kind;
+    put_u16(stream_packet + 4, stream_generation);
+    put_u16(stream_packet + 6, 0);
+    put_u32(stream_packet + 8, stream_sequence);
+    stream_packet_len = STREAM_HEADER_SIZE;
+}
+
+// Function to send the packet being built; a full socket buffer drops it
+void stream_send(size_t len) {
+    if (send(stream_fd, stream_packet, len, MSG_DONTWAIT) == (ssize_t)len) {
+        stat_add(&stream_packets, 1);
+    } else {
+        stat_add(&stream_send_errors, 1);
+    }
+    stream_sequence++;
+    stream_packet_len = 0;
+}
+
+// Function to add records to the current packet, sending it when full
+void stream_append(const EventRecord *records, size_t count) {
+    // Records must never refer to a label the receiver has not been sent
+    if (stream_labels_dirty) {
+        stream_flush();
+        stream_generation++;
+        stream_labels_dirty = 0;
+        stream_send_labels();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const EventRecord *record = &records[i];
+        if (stream_packet_len == 0) {
+            stream_begin_packet(STREAM_EVENTS);
+            if (stream_flush_us > 0) {
+                struct itimerspec its = {{0, 0}, {stream_flush_us / 1000000, (long)(stream_flush_us % 1000000) * 1000}};
+                timerfd_settime(stream_timer_fd, 0, &its, NULL);
+            }
+        }
+
+        uint16_t label = record->type == ButtonPress || record->type == ButtonRelease
+            ? (uint16_t)(STREAM_BUTTON_BASE + (record->detail < STREAM_BUTTONS ? record->detail : 0))
+            : (uint16_t)(record->source * MAX_KEYCODES + record->detail);
+        unsigned char *p = stream_packet + stream_packet_len;
+        put_u32(p, record->server_time);
+        put_u16(p + 4, label);
+        put_u16(p + 6, record->modifiers);
+        p[8] = record->detail;
+        p[9] = record->type;
+        p[10] = record->source;
+        p[11] = record->mouse_button;
+        stream_packet_len += STREAM_RECORD_SIZE;
+        put_u16(stream_packet + 6, (uint16_t)((stream_packet_len - STREAM_HEADER_SIZE) / STREAM_RECORD_SIZE));
+
+        if (stream_packet_len + STREAM_RECORD_SIZE > STREAM_PACKET_SIZE) {
+            stream_flush();
+        }
+    }
+
+    if (stream_flush_us == 0) {
+        stream_flush();
+    }
+}
+
+// Function to send the pending events packet, if any, and disarm its deadline
+void stream_flush(void) {
+    if (stream_packet_len == 0) {
+        return;
+    }
+    struct itimerspec its = {{0, 0}, {0, 0}};
+    timerfd_settime(stream_timer_fd, 0, &its, NULL);
+    stream_send(stream_packet_len);
+}
+
+// Function to send every non-empty label with its id, split over as many packets as needed
+void stream_send_labels(void) {
+    uint16_t entries = 0;
+    stream_begin_packet(STREAM_LABELS);
+
+    for (int id = 0; id < STREAM_BUTTON_BASE + STREAM_BUTTONS; id++) {
+        const char *label;
+        size_t len;
+        if (id >= STREAM_BUTTON_BASE) {
+            if (id == STREAM_BUTTON_BASE) {
+                continue; // Button 0 does not exist
+            }
+            label = mouse_button_to_name(id - STREAM_BUTTON_BASE);
+            len = strlen(label);
+        } else {
+            int source = id / MAX_KEYCODES;
+            if (source >= source_count) {
+                id = STREAM_BUTTON_BASE - 1; // Skip to the buttons
+                continue;
+            }
+            const KeyLabel *key = &sources[source].key_labels[id % MAX_KEYCODES];
+            label = key->label;
+            len = key->len;
+        }
+        if (len == 0) {
+            continue;
+        }
+
+        if (stream_packet_len + 3 + len > STREAM_PACKET_SIZE) {
+            put_u16(stream_packet + 6, entries);
+            stream_send(stream_packet_len);
+            stream_begin_packet(STREAM_LABELS);
+            entries = 0;
+        }
+        unsigned char *p = stream_packet + stream_packet_len;
+        put_u16(p, (uint16_t)id);
+        p[2] = (unsigned char)len;
+        memcpy(p + 3, label, len);
+        stream_packet_len += 3 + len;
+        entries++;
+    }
+
+    put_u16(stream_packet + 6, entries);
+    stream_send(stream_packet_len);
+}
+
+// Function to answer a receiver's hello with the label table
+void handle_stream_fd(void) {
+    unsigned char hello[64];
+    int asked = 0;
+    while (recv(stream_fd, hello, sizeof(hello), MSG_DONTWAIT) >= 0) {
+        asked = 1;
+    }
+
+    // The pending events packet goes first so it is not mixed with the labels
+    if (asked) {
+        stream_flush();
+        stream_send_labels();
+    }
+}
+
+// Function to send the events packet whose flush deadline has passed
+void handle_stream_timer(void) {
+    uint64_t expirations;
+    if (read(stream_timer_fd, &expirations, sizeof(expirations)) == (ssize_t)sizeof(expirations)) {
+        ALLOC_SCOPE_BEGIN("stream_flush");
+        stream_flush();
+        ALLOC_SCOPE_END();
+    }
+}
+
+// Function to read pending signals from the signalfd
+void handle_signal_fd(void) {
+    struct signalfd_siginfo si;
+    int resized = 0;
+    while (read(signal_fd, &si, sizeof(si)) == (ssize_t)sizeof(si)) {
+        if (si.ssi_signo == SIGINT || si.ssi_signo == SIGTERM) {
+            running = 0;
+        } else if (si.ssi_signo == SIGWINCH) {
+            resized = 1;
+        } else if (si.ssi_signo == SIGUSR1) {
+            dump_stats();
+        }
+    }
+
+    // Several resize signals may be queued while dragging; redraw once
+    if (resized && running) {
+        resize_pending = 1;
+        wake_render_thread();
+    }
+}
+
+// Function to handle a timer tick
+void handle_timer_fd(void) {
+    uint64_t expirations;
+    if (read(timer_fd, &expirations, sizeof(expirations)) != (ssize_t)sizeof(expirations)) {
+        return;
+    }
+
+    // Counters only ever grow; report the change since the previous tick
+    static unsigned long last_wakeups = 0, last_frames = 0, last_bytes = 0;
+    unsigned long total_wakeups = loop_wakeups + render_wakeups;
+    unsigned long total_frames = frame_count;
+    unsigned long total_bytes = frame_bytes_total;
+
+    if (show_wakeups) {
+        // The tick that woke us up is not counted against idle usage
+        unsigned long wakeups = total_wakeups - last_wakeups;
+        wakeups = wakeups > 0 ? wakeups - 1 : 0;
+        fprintf(stderr, "wakeups/s: %lu\n", wakeups / (unsigned long)expirations);
+    }
+
+    unsigned long frames = total_frames - last_frames;
+    unsigned long bytes = total_bytes - last_bytes;
+    if (show_frame_bytes && frames > 0) {
+        fprintf(stderr, "frames: %lu, bytes/frame: %lu\n", frames, bytes / frames);
+    }
+
+    last_wakeups = total_wakeups;
+    last_frames = total_frames;
+    last_bytes = total_bytes;
+
+    if (show_ring_stats) {
+        fprintf(stderr, "ring: high-water %zu/%d, dropped %lu, coalesced %lu\n",
+                (size_t)ring_high_water, EVENT_RING_SIZE,
+                (unsigned long)ring_dropped, (unsigned long)frames_coalesced);
+    }
+}
+
+// Function to get terminal size (called at startup and on SIGWINCH)
+void get_terminal_size(int *rows, int *cols) {
+    struct winsize ws;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != -1) {
+        *rows = ws.ws_row;
+        *cols = ws.ws_col;
+    } else {
+        *rows = 24; // Default rows
+        *cols = 80; // Default columns
+    }
+}
+
+// Function to disable the cursor
+void disable_cursor(void) {
+    printf("\033[?25l");  // Hides the cursor
+    fflush(stdout);
+}
+
+// Function to enable the cursor
+void enable_cursor(void) {
+    printf("\033[?25h");  // Shows the cursor
+    fflush(stdout);
+}
+
+// Function to map color names to ANSI codes
+const char *color_name_to_code(const char *color_name, int is_background) {
+    static const struct {
+        const char *name;
+        const char *code_fg;
+        const char *code_bg;
+    } color_table[] = {
+        {"black",   "\033[30m", "\033[40m"},
+        {"red",     "\033[31m", "\033[41m"},
+        {"green",   "\033[32m", "\033[42m"},
+        {"yellow",  "\033[33m", "\033[43m"},
+        {"blue",    "\033[34m", "\033[44m"},
+        {"magenta", "\033[35m", "\033[45m"},
+        {"cyan",    "\033[36m", "\033[46m"},
+        {"white",   "\033[37m", "\033[47m"},
+        {"default", "\033[39m", "\033[49m"},
+        {NULL,      NULL,       NULL}
+    };
+
+    for (int i = 0; color_table[i].name != NULL; i++) {
+        if (strcmp(color_name, color_table[i].name) == 0) {
+            return is_background ? color_table[i].code_bg : color_table[i].code_fg;
+        }
+    }
+    return NULL; // Invalid color
+}
+
+// Function to add bytes to the frame being composed
+void frame_append(const char *data, size_t len) {
+    // A frame bigger than the buffer, such as a full history redraw, goes out
+    // in pieces; the terminal holds them until the synchronized update ends
+    while (len > FRAME_BUFFER_SIZE - frame_len) {
+        size_t room = FRAME_BUFFER_SIZE - frame_len;
+        memcpy(frame_buffer + frame_len, data, room);
+        frame_len += room;
+        data += room;
+        len -= room;
+        frame_send();
+    }
+    memcpy(frame_buffer + frame_len, data, len);
+    frame_len += len;
+}
+
+// Function to send the rest of the composed frame to the terminal and count it
+void frame_write(void) {
+    frame_send();
+
+#ifdef TERMKEY_BENCH
+    latency_bench_written();
+#endif
+
+    stat_add(&frame_count, 1);
+}
+
+// Function to write out and empty the frame buffer
+void frame_send(void) {
+    size_t written = 0;
+    TRACE_BEGIN("write");
+    while (written < frame_len) {
+        ssize_t n = write(output_fd, frame_buffer + written, frame_len - written);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break; // Terminal went away; drop the frame
+        }
+        written += (size_t)n;
+    }
+    TRACE_END("write");
+
+    stat_add(&frame_bytes_total, frame_len);
+    frame_len = 0;
+}
+
+// Function to resolve both blink phases into escape sequences
+void compile_color_phases(void) {
+    for (int swapped = 0; swapped <= 1; swapped++) {
+        ColorPhase *phase = &color_phases[swapped];
+
+        // The swapped phase exchanges background and foreground to create the blink
+        const char *bg_code = color_name_to_code(swapped ? fg_color_name : bg_color_name, 1);
+        const char *fg_code = color_name_to_code(swapped ? bg_color_name : fg_color_name, 0);
+        const char *letter_code = NULL;
+        if (letter_color_name[0] != '\0') {
+            letter_code = color_name_to_code(letter_color_name, 0);
+        }
+
+        phase->prefix = bg_code ? bg_code : "";
+        phase->blank_code = fg_code ? fg_code : "\033[39m"; // Default foreground if unset
+        phase->graph_code = letter_code ? letter_code : phase->blank_code;
+
+        phase->prefix_len = strlen(phase->prefix);
+        phase->blank_len = strlen(phase->blank_code);
+        phase->graph_len = strlen(phase->graph_code);
+    }
+}
+
+// Function to print centered text in the terminal
+void print_centered(const char *message) {
+    static int color_toggle = 0;  // Static variable to keep track of color toggling
+
+    strncpy(current_message, message, sizeof(current_message) - 1);
+    current_message[sizeof(current_message) - 1] = '\0';
+    current_phase = color_toggle;
+
+    render_current_message();
+
+    // Toggle color for next time
+    if (use_color) {
+        color_toggle = !color_toggle;
+    }
+}
+
+// Function to add text in the current colour phase to the frame being composed
+void frame_append_text(const char *text, int len) {
+    // Check if color function is activated
+    if (use_color) {
+        const ColorPhase *phase = &color_phases[current_phase];
+
+        // Apply background color if valid
+        frame_append(phase->prefix, phase->prefix_len);
+
+        // Now add each character, emitting a colour code only where the
+        // attribute changes between isgraph and non-isgraph runs
+        const char *current_code = NULL;
+        for (int i = 0; i < len; i++) {
+            char c = text[i];
+            const char *code;
+            size_t code_len;
+
+            if (isgraph((unsigned char)c)) {
+                code = phase->graph_code;
+                code_len = phase->graph_len;
+            } else {
+                code = phase->blank_code;
+                code_len = phase->blank_len;
+            }
+
+            if (code != current_code) {
+                frame_append(code, code_len);
+                current_code = code;
+            }
+            frame_append(&c, 1);
+        }
+
+        // Reset attributes
+        frame_append("\033[0m", 4);
+
+    } else {
+        // No color, simply add the text
+        frame_append(text, (size_t)len);
+    }
+}
+
+// Function to format the " ×N" suffix for the current repeat count
+int format_repeat_counter(char *counter, size_t size) {
+    if (current_repeat <= 1) {
+        counter[0] = '\0';
+        return 0;
+    }
+    return snprintf(counter, size, " ×%u", current_repeat);
+}
+
+// Function to draw current_message centered with the cached terminal size
+void render_current_message(void) {
+    const char *message = current_message;
+    int len = (int)strlen(message);
+    int width = display_width(message, len);
+    char counter[24];
+    int counter_len = format_repeat_counter(counter, sizeof(counter));
+    int counter_width = display_width(counter, counter_len);
+
+    // Centre on the message alone so a growing repeat counter never moves it
+    int x = (term_cols - len) / 2;
+    int y = term_rows / 2;
+    if (x < 0) {
+        x = 0; // Terminals clamp the cursor to the first column anyway
+    }
+
+    // Begin a synchronized update so the terminal never shows half a frame
+    if (sync_output) {
+        frame_append("\033[?2026h", 8);
+    }
+
+    // Clear the screen only at startup and after a resize
+    int cleared = screen_dirty;
+    if (screen_dirty) {
+        frame_append("\033[H\033[J", 6);
+        screen_dirty = 0;
+        last_frame_width = 0;
+    }
+
+    // Overwrite the union of the previous span and the new one
+    int start = x;
+    int end = x + width + counter_width;
+    if (last_frame_width > 0) {
+        if (last_frame_row == y) {
+            if (last_frame_col < start) {
+                start = last_frame_col;
+            }
+            if (last_frame_col + last_frame_width > end) {
+                end = last_frame_col + last_frame_width;
+            }
+        } else {
+            // Different row: blank the old span on its own
+            char erase[32];
+            int erase_len = snprintf(erase, sizeof(erase), "\033[%d;%dH", last_frame_row, last_frame_col + 1);
+            frame_append(erase, (size_t)erase_len);
+            frame_append_spaces(last_frame_width);
+        }
+    }
+
+    // Move the cursor to the position
+    char cursor[32];
+    int cursor_len = snprintf(cursor, sizeof(cursor), "\033[%d;%dH", y, start + 1); // +1 for 1-based indexing in terminals
+    frame_append(cursor, (size_t)cursor_len);
+    frame_append_spaces(x - start);
+
+    frame_append_text(message, len);
+    frame_append_text(counter, counter_len);
+
+    // Blank whatever is left of the previous message to the right
+    frame_append_spaces(end - (x + width + counter_width));
+
+    last_frame_row = y;
+    last_frame_col = x;
+    last_frame_width = width + counter_width;
+    current_message_width = width;
+
+    if (history_lines > 0) {
+        history_render(y, cleared);
+    }
+
+    if (sync_output) {
+        frame_append("\033[?2026l", 8);
+    }
+
+    frame_write();  // Ensures the text is displayed immediately
+}
+
+// Function to rewrite only the repeat counter after the message on screen
+void render_repeat_counter(void) {
+    if (screen_dirty || last_frame_width == 0) {
+        render_current_message();
+        return;
+    }
+
+    char counter[24];
+    int counter_len = format_repeat_counter(counter, sizeof(counter));
+    int counter_width = display_width(counter, counter_len);
+    int old_counter_width = last_frame_width - current_message_width;
+
+    if (sync_output) {
+        frame_append("\033[?2026h", 8);
+    }
+
+    char cursor[32];
+    int cursor_len = snprintf(cursor, sizeof(cursor), "\033[%d;%dH",
+                              last_frame_row, last_frame_col + current_message_width + 1);
+    frame_append(cursor, (size_t)cursor_len);
+    frame_append_text(counter, counter_len);
+    frame_append_spaces(old_counter_width - counter_width);
+
+    last_frame_width = current_message_width + counter_width;
+
+    if (sync_output) {
+        frame_append("\033[?2026l", 8);
+    }
+
+    frame_write();
+}
+
+// Function to move the message leaving the screen, with its final repeat count, into the history
+void history_push(void) {
+    size_t len = strlen(current_message);
+    if (!history_armed || len == 0) {
+        return; // Only the startup banner, if anything, is on screen
+    }
+
+    HistoryEntry *entry = &history[history_next];
+    history_next = (history_next + 1) & (HISTORY_MAX - 1);
+    if (history_count < HISTORY_MAX) {
+        history_count++;
+    }
+    history_unscrolled++;
+
+    char counter[24];
+    int counter_len = format_repeat_counter(counter, sizeof(counter));
+    memcpy(entry->text, current_message, len);
+    memcpy(entry->text + len, counter, (size_t)counter_len);
+    entry->message_len = (uint16_t)len;
+    entry->len = (uint16_t)(len + (size_t)counter_len);
+    entry->width = (uint16_t)display_width(entry->text, entry->len);
+}
+
+// Function to get a history entry by age, 0 being the most recent
+const HistoryEntry *history_entry(unsigned int age) {
+    return &history[(history_next - 1 - age) & (HISTORY_MAX - 1)];
+}
+
+// Function to map an entry's age to its fade level; the bands are fixed (ages
+// 0-1, 2-3, 4-7, 8+) so a scroll moves at most three lines into a new colour
+int history_fade_level(unsigned int age) {
+    return age < 2 ? 0 : age < 4 ? 1 : age < 8 ? 2 : 3;
+}
+
+// Function to draw one history entry on its row in its fade colour
+void history_draw_entry(unsigned int age, int top_row) {
+    const HistoryEntry *entry = history_entry(age);
+
+    // Centred like the message above it; too wide for the terminal, only the message is kept
+    int len = entry->len;
+    if (entry->width > term_cols) {
+        len = entry->message_len < term_cols ? entry->message_len : term_cols;
+    }
+    int x = (term_cols - entry->message_len) / 2;
+    if (x < 0) {
+        x = 0;
+    }
+
+    char start[48];
+    int start_len = snprintf(start, sizeof(start), "\033[%d;%dH\033[38;5;%dm", top_row + (int)age, x + 1,
+                             history_fade[history_fade_level(age)]);
+    frame_append(start, (size_t)start_len);
+    frame_append(entry->text, (size_t)len);
+    frame_append("\033[0m", 4);
+}
+
+// Function to bring the history pane below the message up to date in the frame being composed
+void history_render(int message_row, int cleared) {
+    int rows = term_rows - message_row;
+    if (rows > (int)history_lines) {
+        rows = (int)history_lines;
+    }
+    int top = message_row + 1;
+    int count = (int)history_count;
+
+    if (rows <= 0) {
+        // No room below the message
+    } else if (cleared) {
+        for (int age = 0; age < count && age < rows; age++) {
+            history_draw_entry((unsigned int)age, top);
+        }
+    } else if (history_unscrolled > 0) {
+        int shift = history_unscrolled < (unsigned int)rows ? (int)history_unscrolled : rows;
+
+        // Shift the pane down inside a scroll region; the oldest lines fall off the bottom
+        char scroll[48];
+        int scroll_len = snprintf(scroll, sizeof(scroll), "\033[%d;%dr\033[%dT\033[r", top, top + rows - 1, shift);
+        frame_append(scroll, (size_t)scroll_len);
+
+        for (int age = 0; age < shift && age < count; age++) {
+            history_draw_entry((unsigned int)age, top);
+        }
+
+        // Redraw only the lines that moved into an older fade level
+        for (int age = shift; age < rows && age < count; age++) {
+            if (history_fade_level((unsigned int)age) != history_fade_level((unsigned int)(age - shift))) {
+                history_draw_entry((unsigned int)age, top);
+            }
+        }
+    }
+    history_unscrolled = 0;
+}
+
+// Function to ask the terminal whether it supports synchronized output.
+// DECRQM for mode 2026 is followed by a primary device attributes request,
+// which every terminal answers, so a terminal that ignores DECRQM is detected
+// by the DA1 reply arriving alone instead of by waiting for the timeout.
+int probe_sync_output(void) {
+    int tty = open("/dev/tty", O_RDWR | O_NOCTTY | O_CLOEXEC);
+    if (tty == -1) {
+        return 0;
+    }
+
+    struct termios saved, raw;
+    if (tcgetattr(tty, &saved) == -1) {
+        close(tty);
+        return 0;
+    }
+    raw = saved;
+    raw.c_lflag &= (tcflag_t)~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(tty, TCSANOW, &raw);
+
+    static const char query[] = "\033[?2026$p\033[c";
+    ssize_t n = write(tty, query, sizeof(query) - 1);
+
+    char reply[128];
+    size_t reply_len = 0;
+    int supported = 0;
+    int done = (n != (ssize_t)(sizeof(query) - 1));
+
+    while (!done && reply_len < sizeof(reply) - 1) {
+        struct pollfd pfd = {tty, POLLIN, 0};
+        if (poll(&pfd, 1, SYNC_PROBE_TIMEOUT) <= 0) {
+            break; // No answer at all; assume unsupported
+        }
+        n = read(tty, reply + reply_len, sizeof(reply) - 1 - reply_len);
+        if (n <= 0) {
+            break;
+        }
+        reply_len += (size_t)n;
+        reply[reply_len] = '\0';
+
+        // DECRPM reply: CSI ? 2026 ; Ps $ y, where Ps 1-3 means the mode is usable
+        const char *report = strstr(reply, "\033[?2026;");
+        if (report != NULL && strchr(report, 'y') != NULL) {
+            char ps = report[8];
+            supported = (ps == '1' || ps == '2' || ps == '3');
+        }
+
+        // The DA1 reply (CSI ? ... c) always comes last
+        const char *da = strstr(reply, "\033[?");
+        while (da != NULL) {
+            const char *end = da + 3;
+            while (*end != '\0' && ((*end >= '0' && *end <= '9') || *end == ';')) {
+                end++;
+            }
+            if (*end == 'c') {
+                done = 1;
+                break;
+            }
+            da = strstr(da + 1, "\033[?");
+        }
+    }
+
+    tcsetattr(tty, TCSANOW, &saved);
+    close(tty);
+    return supported;
+}
+
+// Function to add padding spaces to the frame being composed
+void frame_append_spaces(int count) {
+    static const char spaces[] = "                                                                ";
+    while (count > 0) {
+        int chunk = count < (int)(sizeof(spaces) - 1) ? count : (int)(sizeof(spaces) - 1);
+        frame_append(spaces, (size_t)chunk);
+        count -= chunk;
+    }
+}
+
+// Function to count the terminal cells of a UTF-8 string (one per code point)
+int display_width(const char *text, int len) {
+    int width = 0;
+    for (int i = 0; i < len; i++) {
+        if (((unsigned char)text[i] & 0xC0) != 0x80) {
+            width++;
+        }
+    }
+    return width;
+}
 
 // Function to convert mouse button number to name
 const char *mouse_button_to_name(int button) {
@@ -370,162 +2624,2284 @@ const char *mouse_button_to_name(int button) {
     }
 }
 
-// Function to convert KeySym to a friendly name
-const char *keysym_to_string(KeySym keysym) {
-    // Check if the key is in the special key map
-    for (size_t i = 0; i < SPECIAL_KEY_MAP_SIZE; i++) {
-        if (special_key_map[i].keysym == keysym) {
-            return special_key_map[i].name;
+// Function to convert KeySym to a friendly name; the result is not NUL-terminated
+const char *keysym_to_string(KeySym keysym, size_t *len) {
+    // Check if the key is in the special key map
+    for (size_t i = 0; i < SPECIAL_KEY_MAP_SIZE; i++) {
+        if (special_key_map[i].keysym == keysym) {
+            *len = strlen(special_key_map[i].name);
+            return special_key_map[i].name;
+        }
+    }
+
+    // If not, look the name up in the generated table
+    if (keysym != NoSymbol && keysym <= 0xffffffff) {
+        uint32_t bucket = keysym_hash((uint32_t)keysym, 0) % KEYSYM_BUCKET_COUNT;
+        const KeysymName *entry = &keysym_names[keysym_hash((uint32_t)keysym, keysym_bucket_seeds[bucket]) % KEYSYM_NAME_COUNT];
+        if (entry->keysym == keysym) {
+            *len = entry->name & 0xff;
+            return keysym_name_pool + (entry->name >> 8);
+        }
+    }
+
+    // Unicode keysyms without a name of their own are spelled U+codepoint, as Xlib does
+    if (keysym >= 0x01000100 && keysym <= 0x0110ffff) {
+        static _Thread_local char unicode_name[16];
+        uint32_t codepoint = keysym & 0xffffff;
+        *len = snprintf(unicode_name, sizeof(unicode_name), "U%0*X", codepoint > 0xffff ? 6 : 4, codepoint);
+        return unicode_name;
+    }
+    return NULL;
+}
+
+// Function to hash a keysym for the generated name table; must match tools/gen_keysym_names.py
+uint32_t keysym_hash(uint32_t keysym, uint32_t seed) {
+    keysym ^= seed;
+    keysym *= 0x9E3779B1u;
+    keysym ^= keysym >> 16;
+    keysym *= 0x85EBCA6Bu;
+    keysym ^= keysym >> 13;
+    return keysym;
+}
+
+// Function to fill a display's key table with the uppercased name of every keycode
+void build_key_label_table(CaptureSource *source) {
+    // One request fetches the whole keysym map; every lookup below is local
+    XkbDescPtr xkb = XkbGetMap(source->display, XkbKeySymsMask, XkbUseCoreKbd);
+    if (xkb == NULL) {
+        fprintf(stderr, "Error reading the keyboard map.\n");
+        return;
+    }
+
+    // Rewritten in place: this thread is the only one that reads it
+    memset(source->key_labels, 0, sizeof(source->key_labels));
+    for (int keycode = xkb->min_key_code; keycode <= xkb->max_key_code && keycode < MAX_KEYCODES; keycode++) {
+        KeySym keysym = XkbKeyNumSyms(xkb, keycode) > 0 ? XkbKeySymEntry(xkb, keycode, 0, 0) : NoSymbol;
+        fill_key_label(&source->key_labels[keycode], keysym);
+    }
+    XkbFreeKeyboard(xkb, 0, True);
+
+    stream_labels_dirty = 1;
+}
+
+// Function to set one table entry from a keysym
+void fill_key_label(KeyLabel *key, KeySym keysym) {
+    key->keysym = keysym;
+    key->modifier_bit = keysym_to_modifier_bit(keysym);
+    key->len = 0;
+    key->label[0] = '\0';
+
+    size_t key_len = 0;
+    const char *key_string = keysym_to_string(keysym, &key_len);
+    if (key_string == NULL) {
+        return;
+    }
+
+    size_t len = 0;
+    while (len < key_len && len < sizeof(key->label) - 1) {
+        key->label[len] = toupper((unsigned char)key_string[len]);
+        len++;
+    }
+    key->label[len] = '\0';
+    key->len = len;
+}
+
+// Function to process events on a display's control connection (keymap changes)
+void handle_control_events(CaptureSource *source) {
+    int rebuild = 0;
+
+    while (XPending(source->display)) {
+        XEvent ev;
+        XNextEvent(source->display, &ev);
+
+        // The table is rebuilt from a fresh XkbGetMap, so Xlib's own keymap
+        // cache does not need refreshing; a notification only invalidates
+        if (ev.type == MappingNotify) {
+            rebuild = 1;
+        } else if (ev.type == source->xkb_event_base + XkbEventCode) {
+            XkbEvent *xkb_ev = (XkbEvent *)&ev;
+            if (xkb_ev->any.xkb_type == XkbMapNotify ||
+                xkb_ev->any.xkb_type == XkbNewKeyboardNotify) {
+                rebuild = 1;
+            }
+        }
+    }
+
+    // A layout switch usually arrives as a burst of notifications; rebuild once
+    if (rebuild) {
+        build_key_label_table(source);
+    }
+}
+
+// Function to print usage instructions
+void print_usage(const char *prog_name) {
+    printf("Usage: %s [-c bg_color [fg_color [letter_color]]] [--sync] [--repeat-window ms] [--max-fps n]\n", prog_name);
+    printf("       %*s [--history lines] [--key-stats file [--key-stats-interval s]] [--heatmap]\n", (int)strlen(prog_name), "");
+    printf("       %*s [--only-combos mods] [--exclude-keys first[-last]]... [--mouse-only]\n", (int)strlen(prog_name), "");
+    printf("       %*s [--sequences file [--sequence-timeout ms]]\n", (int)strlen(prog_name), "");
+    printf("       %*s [--log file] [--replay file [--replay-fast]] [--no-display]\n", (int)strlen(prog_name), "");
+    printf("       %*s [--stats] [--stats-file file] [--wakeups] [--frame-bytes] [--ring-stats]\n", (int)strlen(prog_name), "");
+    printf("       %*s [--evdev] [--evdev-device path]... [-d display]...\n", (int)strlen(prog_name), "");
+    printf("       %*s [--daemon name | --view name] [--stream addr [--stream-flush us]]\n", (int)strlen(prog_name), "");
+    printf("Available colors: black, red, green, yellow, blue, magenta, cyan, white, default\n");
+    printf("Examples:\n");
+    printf("  %s -c red blue             # Background red, foreground blue\n", prog_name);
+    printf("  %s -c red default          # Background red, foreground default\n", prog_name);
+    printf("  %s -c default green        # Background default, foreground green\n", prog_name);
+    printf("  %s -c default default red  # Only letters colored red\n", prog_name);
+    printf("  %s --wakeups               # Report event loop wakeups per second on stderr\n", prog_name);
+    printf("  %s --frame-bytes           # Report frames and bytes per frame on stderr\n", prog_name);
+    printf("  %s --ring-stats            # Report capture ring usage on stderr\n", prog_name);
+    printf("  %s --sync                  # Use synchronized output if the terminal supports it\n", prog_name);
+    printf("  %s --repeat-window 0       # Redraw every repeat instead of showing \"A ×12\"\n", prog_name);
+    printf("  %s --max-fps 20            # Draw at most 20 frames per second (latest wins)\n", prog_name);
+    printf("  %s --history 8             # Keep the last 8 combos below the current one\n", prog_name);
+    printf("  %s --log keys.tkl --no-display  # Record events to a binary log, headless\n", prog_name);
+    printf("  %s --replay keys.tkl       # Play a recorded log back in real time\n", prog_name);
+    printf("  %s -d :1 -d :2             # Capture two X displays, tagging each message\n", prog_name);
+    printf("  %s --daemon lab            # Capture headless and publish to the shared-memory bus \"lab\"\n", prog_name);
+    printf("  %s --view lab              # Draw what the \"lab\" daemon publishes\n", prog_name);
+    printf("  %s --stream udp:obs.lan:9000  # Send batched events to a remote overlay\n", prog_name);
+    printf("  %s --evdev                 # Read /dev/input directly, without an X server\n", prog_name);
+    printf("  %s --only-combos ctrl,super  # Show shortcuts but never plain typing\n", prog_name);
+    printf("  %s --sequences emacs.seq   # Show \"ctrl+x ctrl+f\" as the action named in the file\n", prog_name);
+    printf("  %s --key-stats keys.csv    # Count key presses and shortcuts, rewritten every minute\n", prog_name);
+    printf("  %s --stats                 # Print counters and latency percentiles at exit (also on SIGUSR1)\n", prog_name);
+    printf("  %s -c                      # Display this help message\n", prog_name);
+    exit(EXIT_SUCCESS);
+}
+
+// Function to map a modifier keysym to its ModifierState bit
+ModifierState keysym_to_modifier_bit(KeySym keysym) {
+    switch (keysym) {
+        case XK_Shift_L:          return MOD_SHIFT_L;
+        case XK_Shift_R:          return MOD_SHIFT_R;
+        case XK_Control_L:        return MOD_CTRL_L;
+        case XK_Control_R:        return MOD_CTRL_R;
+        case XK_Alt_L:            return MOD_ALT_L;
+        case XK_Alt_R:            return MOD_ALT_R;
+        case XK_Meta_L:           return MOD_META_L;
+        case XK_Meta_R:           return MOD_META_R;
+        case XK_ISO_Level3_Shift: return MOD_ALTGR;
+        case XK_Super_L:          return MOD_SUPER_L;
+        case XK_Super_R:          return MOD_SUPER_R;
+        default:                  return 0;
+    }
+}
+
+// Function to update a display's modifier keys state
+void update_modifier_state(CaptureSource *source, ModifierState modifier_bit, int is_key_press) {
+    if (is_key_press) {
+        source->modifiers |= modifier_bit;
+    } else {
+        source->modifiers &= (ModifierState)~modifier_bit;
+    }
+}
+
+// Function to test a key event against the compiled filter; two bit tests
+int filter_key_event(uint8_t keycode, ModifierState modifier_bit, ModifierState modifiers) {
+    if (!((event_filter.keys[keycode >> 6] >> (keycode & 63)) & 1)) {
+        return 0;
+    }
+    // Modifier keys pass so that viewers see the same held modifiers
+    return (modifiers & event_filter.require_any) != 0 || event_filter.require_any == 0 || modifier_bit != 0;
+}
+
+// Function to apply the filter to an already decoded record, as --replay and --view get them
+int filter_record(const EventRecord *record) {
+    if (record->type != KeyPress && record->type != KeyRelease) {
+        return 1;
+    }
+    if (filter_key_event(record->detail, keysym_to_modifier_bit(record->keysym), record->modifiers)) {
+        return 1;
+    }
+    stat_add(&events_filtered, 1);
+    return 0;
+}
+
+// Function to parse "ctrl,super" or "ctrl+super" style modifier names into a mask of both sides' bits
+int parse_modifier_list(const char *list, ModifierState *mask) {
+    static const struct {
+        const char *name;
+        ModifierState bits;
+    } names[] = {
+        {"ctrl",  MOD_CTRL_L | MOD_CTRL_R},
+        {"alt",   MOD_ALT_L | MOD_ALT_R},
+        {"shift", MOD_SHIFT_L | MOD_SHIFT_R},
+        {"meta",  MOD_META_L | MOD_META_R},
+        {"altgr", MOD_ALTGR},
+        {"super", MOD_SUPER_L | MOD_SUPER_R}
+    };
+
+    *mask = 0;
+    while (*list != '\0') {
+        size_t len = strcspn(list, ",+");
+        size_t i = 0;
+        while (i < sizeof(names) / sizeof(names[0]) &&
+               (strlen(names[i].name) != len || strncmp(list, names[i].name, len) != 0)) {
+            i++;
+        }
+        if (i == sizeof(names) / sizeof(names[0])) {
+            return -1;
+        }
+        *mask |= names[i].bits;
+        list += len;
+        if (*list == ',' || *list == '+') {
+            list++;
+        }
+    }
+    return *mask != 0 ? 0 : -1;
+}
+
+// Function to parse a keycode or an inclusive "first-last" range of keycodes
+int parse_keycode_range(const char *range, int *first, int *last) {
+    char *end = NULL;
+    long low = strtol(range, &end, 10);
+    long high = low;
+    if (end == range) {
+        return -1;
+    }
+    if (*end == '-') {
+        const char *second = end + 1;
+        high = strtol(second, &end, 10);
+        if (end == second) {
+            return -1;
+        }
+    }
+    if (*end != '\0' || low < 0 || high >= MAX_KEYCODES || low > high) {
+        return -1;
+    }
+    *first = (int)low;
+    *last = (int)high;
+    return 0;
+}
+
+// Function to get the display prefix for a set of held modifiers
+const ModifierPrefix *modifier_prefix(ModifierState mask) {
+    ModifierPrefix *prefix = &modifier_prefixes[mask & (MODIFIER_COMBINATIONS - 1)];
+    if (!prefix->built) {
+        prefix->len = 0;
+        for (int i = 0; i < MODIFIER_COUNT; i++) {
+            if (mask & (1 << i)) {
+                size_t name_len = strlen(modifier_names[i]);
+                memcpy(prefix->text + prefix->len, modifier_names[i], name_len);
+                prefix->len += name_len;
+            }
+        }
+        prefix->text[prefix->len] = '\0';
+        prefix->built = 1;
+    }
+    return prefix;
+}
+
+// Callback function to process intercepted events
+void event_callback(XPointer priv, XRecordInterceptData *data) {
+    ALLOC_SCOPE_BEGIN("event_callback");
+    process_intercept((CaptureSource *)priv, data);
+    ALLOC_SCOPE_END();
+
+    // Free the intercepted event data
+    XRecordFreeData(data);
+}
+
+// Function to decode every event in an intercept and queue the records together
+void process_intercept(CaptureSource *source, const XRecordInterceptData *data) {
+    if (data->category != XRecordFromServer || data->data == NULL) {
+        return;
+    }
+
+    // Under load the server packs several device events into one intercept;
+    // data_len counts 4-byte units
+    const xEvent *events = (const xEvent *)data->data;
+    size_t count = (size_t)data->data_len * 4 / sizeof(xEvent);
+    EventRecord batch[INTERCEPT_BATCH];
+    size_t batched = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (decode_event(source, &events[i], (uint32_t)data->server_time, &batch[batched])) {
+            batched++;
+        }
+        if (batched == INTERCEPT_BATCH || (i + 1 == count && batched > 0)) {
+            queue_records(batch, batched);
+            batched = 0;
+        }
+    }
+}
+
+// Function to decode one xEvent into a record, returning 0 if it is not one we show
+int decode_event(CaptureSource *source, const xEvent *event, uint32_t server_time, EventRecord *record) {
+    // Packed events carry their own timestamps; the intercept's is the first one's
+    uint32_t time = event->u.keyButtonPointer.time != 0 ? (uint32_t)event->u.keyButtonPointer.time : server_time;
+
+    // Ignore the send_event bit
+    return decode_input(source, event->u.u.type & 0x7F, event->u.u.detail, time, record);
+}
+
+// Function to apply a key or button event in X terms to the input state and
+// fill its record; shared by every input backend
+int decode_input(CaptureSource *source, int event_type, uint8_t detail, uint32_t time, EventRecord *record) {
+    TRACE_BEGIN("translate");
+    const KeyLabel *key_labels = source->key_labels;
+
+    // Mouse event handling
+    if (event_type == ButtonPress) {
+        source->mouse_button_pressed = detail; // The detail field contains the button number
+    } else if (event_type == ButtonRelease) {
+        source->mouse_button_pressed = 0; // Mouse button released
+    }
+    // Keyboard event handling
+    else if (event_type == KeyPress || event_type == KeyRelease) {
+        // Update the state of modifier keys
+        update_modifier_state(source, key_labels[detail].modifier_bit, event_type == KeyPress);
+
+        // Filtered keys still move the modifier state, but go no further
+        if (!filter_key_event(detail, key_labels[detail].modifier_bit, source->modifiers)) {
+            stat_add(&events_filtered, 1);
+            TRACE_END("translate");
+            return 0;
+        }
+    } else {
+        TRACE_END("translate");
+        return 0;
+    }
+
+    memset(record, 0, sizeof(*record));
+    record->server_time = time;
+    if (event_type == KeyPress || event_type == KeyRelease) {
+        record->keysym = (uint32_t)key_labels[detail].keysym;
+    }
+    record->modifiers = source->modifiers;
+    record->type = (uint8_t)event_type;
+    record->detail = detail;
+    record->mouse_button = (uint8_t)source->mouse_button_pressed;
+    record->source = (uint8_t)(source - sources);
+    TRACE_END("translate");
+    stat_add(&event_counts[event_type - KeyPress], 1);
+
+#ifdef TERMKEY_BENCH
+    latency_bench_seen(record);
+#endif
+    return 1;
+}
+
+// Function to hand a batch of decoded records to the log and the render thread
+void queue_records(const EventRecord *records, size_t count) {
+    if (key_stats_enabled) {
+        for (size_t i = 0; i < count; i++) {
+            key_stats_add(&records[i]);
+        }
+    }
+    if (log_map != NULL) {
+        for (size_t i = 0; i < count; i++) {
+            log_append(&records[i]);
+        }
+    }
+    if (bus != NULL) {
+        bus_publish(records, count);
+    }
+    if (stream_fd != -1) {
+        stream_append(records, count);
+    }
+    if (display_enabled) {
+        ring_push_batch(records, count);
+    }
+}
+
+// Function to create the event log and write its header
+int log_open(const char *path) {
+    log_fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (log_fd == -1) {
+        perror(path);
+        return -1;
+    }
+
+    if (log_map_chunk(0) != 0) {
+        close(log_fd);
+        log_fd = -1;
+        return -1;
+    }
+
+    LogHeader header = {LOG_MAGIC, LOG_VERSION, sizeof(EventRecord)};
+    memcpy(log_map, &header, sizeof(header));
+    log_map_used = sizeof(header);
+    return 0;
+}
+
+// Function to reserve and map the chunk of the log starting at offset
+int log_map_chunk(off_t offset) {
+    // Reserve real blocks so a full disk is an error here, not a SIGBUS later
+    int err = posix_fallocate(log_fd, offset, LOG_CHUNK_SIZE);
+    if (err != 0) {
+        fprintf(stderr, "Error growing event log: %s\n", strerror(err));
+        return -1;
+    }
+
+    void *map = mmap(NULL, LOG_CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, log_fd, offset);
+    if (map == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+
+    log_map = map;
+    log_map_offset = offset;
+    log_map_used = 0;
+    return 0;
+}
+
+// Function to append a record to the event log; no syscall unless a chunk fills up
+void log_append(const EventRecord *record) {
+    if (log_map_used + sizeof(*record) > LOG_CHUNK_SIZE) {
+        munmap(log_map, LOG_CHUNK_SIZE);
+        log_map = NULL;
+        if (log_map_chunk(log_map_offset + LOG_CHUNK_SIZE) != 0) {
+            fprintf(stderr, "Event logging stopped.\n");
+            return;
+        }
+    }
+
+    memcpy(log_map + log_map_used, record, sizeof(*record));
+    log_map_used += sizeof(*record);
+}
+
+// Function to unmap the log and trim the unused tail of the last chunk
+void log_close(void) {
+    if (log_fd == -1) {
+        return;
+    }
+
+    off_t size = log_map_offset + (off_t)log_map_used;
+    if (log_map != NULL) {
+        munmap(log_map, LOG_CHUNK_SIZE);
+        log_map = NULL;
+    }
+    if (ftruncate(log_fd, size) == -1) {
+        perror("ftruncate");
+    }
+    close(log_fd);
+    log_fd = -1;
+}
+
+// Function to start the render thread if the display is enabled
+int start_render_thread(void) {
+    if (display_enabled && pthread_create(&render_thread, NULL, render_thread_main, NULL) != 0) {
+        fprintf(stderr, "Error starting render thread.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to stop the render thread after it has drawn its last frame
+void stop_render_thread(void) {
+    running = 0;
+    if (display_enabled) {
+        wake_render_thread();
+        pthread_join(render_thread, NULL);
+    }
+}
+
+// Function to map a recorded log and feed its records through the render pipeline
+int replay_log(const char *path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        perror(path);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(LogHeader)) {
+        fprintf(stderr, "%s: not a termkey event log.\n", path);
+        close(fd);
+        return -1;
+    }
+
+    size_t size = (size_t)st.st_size;
+    const unsigned char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    madvise((void *)map, size, MADV_SEQUENTIAL);
+
+    const LogHeader *header = (const LogHeader *)map;
+    if (memcmp(header->magic, LOG_MAGIC, sizeof(LOG_MAGIC)) != 0 ||
+        header->version != LOG_VERSION || header->record_size != sizeof(EventRecord)) {
+        fprintf(stderr, "%s: unsupported event log format.\n", path);
+        munmap((void *)map, size);
+        return -1;
+    }
+
+    // Records are read in place from the mapping
+    const EventRecord *records = (const EventRecord *)(map + sizeof(LogHeader));
+    size_t count = (size_t)((size - sizeof(LogHeader)) / sizeof(EventRecord));
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    size_t replayed = 0;
+
+    // Each display has its own server clock, so every source is paced from its
+    // own first record, starting where the replay was when that source joined
+    uint32_t source_first[MAX_SOURCES];
+    long source_base[MAX_SOURCES];
+    int source_seen[MAX_SOURCES] = {0};
+    long last_due_ms = 0;
+
+    for (size_t i = 0; i < count && running; i++) {
+        const EventRecord *record = &records[i];
+        if (record->type == 0) {
+            break; // Zero-filled tail of a log that was not closed cleanly
+        }
+
+        if (record->type < KeyPress || record->type > ButtonRelease || record->source >= MAX_SOURCES) {
+            continue; // Not something termkey records
+        }
+
+        // A log recorded from several displays is shown tagged the same way
+        if (record->source != 0 && !show_source_tags) {
+            show_source_tags = 1;
+        }
+
+        if (filter_active && !filter_record(record)) {
+            continue;
+        }
+        stat_add(&event_counts[record->type - KeyPress], 1);
+        if (key_stats_enabled) {
+            key_stats_add(record);
+        }
+
+        if (!replay_fast) {
+            if (!source_seen[record->source]) {
+                source_seen[record->source] = 1;
+                source_first[record->source] = record->server_time;
+                source_base[record->source] = last_due_ms;
+            }
+
+            // Sleep until the record's offset from its source's first one has
+            // elapsed; a timestamp that went backwards is due immediately
+            long due_ms = source_base[record->source] +
+                          (int32_t)(record->server_time - source_first[record->source]);
+            if (due_ms < last_due_ms) {
+                due_ms = last_due_ms;
+            }
+            last_due_ms = due_ms;
+
+            while (running) {
+                struct timespec now;
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                long elapsed_ms = (long)(now.tv_sec - start.tv_sec) * 1000 +
+                                  (now.tv_nsec - start.tv_nsec) / 1000000;
+                if (due_ms <= elapsed_ms) {
+                    break;
+                }
+                long wait_ms = due_ms - elapsed_ms;
+                poll_replay_fds(wait_ms > INT_MAX ? INT_MAX : (int)wait_ms);
+            }
+            if (!running) {
+                break;
+            }
+        } else if ((i & 4095) == 0) {
+            poll_replay_fds(0);
+        }
+
+        if (display_enabled) {
+            // Replay must be reproducible, so wait for room instead of dropping
+            while (ring_full()) {
+                wake_render_thread();
+                sched_yield();
+            }
+            ring_push(record);
+            if (!replay_fast || (i & 63) == 0) {
+                wake_render_thread();
+            }
+        }
+        replayed++;
+    }
+    wake_render_thread();
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    if (replay_fast) {
+        fprintf(stderr, "Replayed %zu events in %.3f s (%.0f events/s)\n",
+                replayed, seconds, seconds > 0 ? (double)replayed / seconds : 0.0);
+    }
+
+    munmap((void *)map, size);
+    return 0;
+}
+
+// Function to service signals and the stats timer while replay waits
+void poll_replay_fds(int timeout_ms) {
+    struct pollfd fds[2] = {
+        {signal_fd, POLLIN, 0},
+        {timer_fd, POLLIN, 0}
+    };
+
+    if (poll(fds, 2, timeout_ms) > 0) {
+        if (fds[0].revents & POLLIN) {
+            handle_signal_fd();
+        }
+        if (fds[1].revents & POLLIN) {
+            handle_timer_fd();
+        }
+    }
+}
+
+// Function to check whether the ring has room for another record
+int ring_full(void) {
+    size_t head = atomic_load_explicit(&event_ring.head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&event_ring.tail, memory_order_acquire);
+    return head - tail >= EVENT_RING_SIZE;
+}
+
+// Function to queue a record for the render thread; drops it if the ring is full
+int ring_push(const EventRecord *record) {
+    return ring_push_batch(record, 1) == 1;
+}
+
+// Function to queue records with a single head update, dropping what does not fit
+size_t ring_push_batch(const EventRecord *records, size_t count) {
+    size_t head = atomic_load_explicit(&event_ring.head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&event_ring.tail, memory_order_acquire);
+
+    size_t space = EVENT_RING_SIZE - (head - tail);
+    size_t queued = count < space ? count : space;
+    if (queued < count) {
+        stat_add(&ring_dropped, count - queued);
+    }
+    if (queued == 0) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < queued; i++) {
+        event_ring.records[(head + i) & (EVENT_RING_SIZE - 1)] = records[i];
+    }
+    atomic_store_explicit(&event_ring.head, head + queued, memory_order_release);
+    stat_add(&ring_pushed, queued);
+
+    size_t used = head + queued - tail;
+    if (used > atomic_load_explicit(&ring_high_water, memory_order_relaxed)) {
+        atomic_store_explicit(&ring_high_water, used, memory_order_relaxed);
+    }
+    return queued;
+}
+
+// Function to take the oldest record off the ring
+int ring_pop(EventRecord *record) {
+    size_t tail = atomic_load_explicit(&event_ring.tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&event_ring.head, memory_order_acquire);
+
+    if (tail == head) {
+        return 0;
+    }
+
+    *record = event_ring.records[tail & (EVENT_RING_SIZE - 1)];
+    atomic_store_explicit(&event_ring.tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+// Function to wake the render thread if new records were queued or it has to stop
+void wake_render_thread(void) {
+    size_t head = atomic_load_explicit(&event_ring.head, memory_order_relaxed);
+    if (head == render_wake_head && running && !resize_pending) {
+        return; // Nothing new since the last wakeup
+    }
+    render_wake_head = head;
+
+    uint64_t one = 1;
+    ssize_t n = write(render_wake_fd, &one, sizeof(one));
+    (void)n;
+}
+
+// Render thread: sleep until woken or the frame deadline passes, then draw
+void *render_thread_main(void *arg) {
+    (void)arg;
+    TRACE_THREAD("render");
+
+    struct pollfd fds[3] = {
+        {render_wake_fd, POLLIN, 0},
+        {render_timer_fd, POLLIN, 0},
+        {sequence_timer_fd, POLLIN, 0}    // Ignored by poll() while -1
+    };
+
+    while (running) {
+        if (poll(fds, 3, -1) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        stat_add(&render_wakeups, 1);
+
+        uint64_t count;
+        if (fds[0].revents & POLLIN) {
+            ssize_t n = read(render_wake_fd, &count, sizeof(count));
+            (void)n;
+        }
+        if (fds[1].revents & POLLIN) {
+            ssize_t n = read(render_timer_fd, &count, sizeof(count));
+            (void)n;
+            render_timer_armed = 0;
+        }
+
+        ALLOC_SCOPE_BEGIN("render");
+        // A timeout is settled before newer strokes are matched
+        if ((fds[2].revents & POLLIN) && read(sequence_timer_fd, &count, sizeof(count)) == (ssize_t)sizeof(count)) {
+            sequence_expire();
+        }
+        collect_pending_records();
+
+        if (atomic_exchange(&resize_pending, 0)) {
+            get_terminal_size(&term_rows, &term_cols);
+            screen_dirty = 1;
+            if (!pending_new_message) {
+                render_current_message();
+            }
+        }
+
+        flush_pending_frame();
+        ALLOC_SCOPE_END();
+    }
+
+    // Whatever was held back by the limiter is still worth showing
+    collect_pending_records();
+    max_fps = 0;
+    flush_pending_frame();
+
+    return NULL;
+}
+
+// Function to drain the ring into the pending state, keeping only the latest combo
+void collect_pending_records(void) {
+    EventRecord record;
+    char message[MAX_FRAME_MESSAGE];
+
+    while (ring_pop(&record)) {
+#ifdef TERMKEY_BENCH
+        latency_bench_collected(&record);
+#endif
+        TRACE_BEGIN("format");
+        int formatted = format_record(&record, message);
+        TRACE_END("format");
+        if (!formatted) {
+            continue;
+        }
+        pending_records++;
+
+        // Strokes of a sequence in progress draw nothing; a completed one draws its name
+        uint64_t key = record_repeat_key(&record);
+        if (sequence_node_count > 0 && sequence_advance(&record, message, &key)) {
+            continue;
+        }
+
+        // The same combo again within the window only bumps the counter
+        if (repeat_window > 0 && key == last_repeat_key &&
+            record.server_time - last_repeat_time <= repeat_window) {
+            pending_repeat++;
+            if (!pending_new_message) {
+                pending_repeat_only = 1;
+            }
+        } else {
+            memcpy(pending_message, message, sizeof(pending_message));
+            pending_repeat = 1;
+            pending_new_message = 1;
+            pending_repeat_only = 0;
+        }
+        last_repeat_key = key;
+        last_repeat_time = record.server_time;
+    }
+}
+
+// Function to draw the pending state, unless the frame-rate limiter says to wait
+void flush_pending_frame(void) {
+    if (!pending_new_message && !pending_repeat_only) {
+        return; // Nothing changed since the last frame
+    }
+
+    struct timespec now;
+    if (max_fps > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (now.tv_sec < next_frame_time.tv_sec ||
+            (now.tv_sec == next_frame_time.tv_sec && now.tv_nsec < next_frame_time.tv_nsec)) {
+            // Too early; draw the latest state when the deadline passes
+            if (!render_timer_armed) {
+                struct itimerspec its = {{0, 0}, next_frame_time};
+                timerfd_settime(render_timer_fd, TFD_TIMER_ABSTIME, &its, NULL);
+                render_timer_armed = 1;
+            }
+            return;
+        }
+    }
+
+    if (pending_new_message && history_lines > 0) {
+        history_push(); // Still holds the outgoing message and its count
+    }
+    current_repeat = pending_repeat;
+    if (pending_new_message) {
+        print_centered(pending_message);
+        history_armed = 1;
+    } else {
+        render_repeat_counter();
+    }
+
+    stats_record_latency(last_repeat_time);
+
+    if (pending_records > 1) {
+        stat_add(&frames_coalesced, pending_records - 1);
+    }
+    pending_records = 0;
+    pending_new_message = 0;
+    pending_repeat_only = 0;
+
+    if (max_fps > 0) {
+        long interval = 1000000000L / (long)max_fps;
+        next_frame_time.tv_sec = now.tv_sec;
+        next_frame_time.tv_nsec = now.tv_nsec + interval;
+        if (next_frame_time.tv_nsec >= 1000000000L) {
+            next_frame_time.tv_sec += next_frame_time.tv_nsec / 1000000000L;
+            next_frame_time.tv_nsec %= 1000000000L;
+        }
+    }
+}
+
+// Function to identify what a record displays, for repeat detection
+uint64_t record_repeat_key(const EventRecord *record) {
+    if (record->type == ButtonPress) {
+        return (uint64_t)record->type | ((uint64_t)record->detail << 8) | ((uint64_t)record->source << 40);
+    }
+
+    ModifierState shown = record->modifiers & (ModifierState)~keysym_to_modifier_bit(record->keysym);
+    return (uint64_t)record->type | ((uint64_t)record->detail << 8) |
+           ((uint64_t)record->mouse_button << 16) | ((uint64_t)shown << 24) |
+           ((uint64_t)record->source << 40);
+}
+
+// Function to fold sided modifier bits into one bit per kind: ctrl, alt, shift, meta, altgr, super
+uint8_t modifier_kinds(ModifierState mask) {
+    return (uint8_t)(((mask & (MOD_CTRL_L | MOD_CTRL_R)) ? 1 : 0) |
+                     ((mask & (MOD_ALT_L | MOD_ALT_R)) ? 2 : 0) |
+                     ((mask & (MOD_SHIFT_L | MOD_SHIFT_R)) ? 4 : 0) |
+                     ((mask & (MOD_META_L | MOD_META_R)) ? 8 : 0) |
+                     ((mask & MOD_ALTGR) ? 16 : 0) |
+                     ((mask & (MOD_SUPER_L | MOD_SUPER_R)) ? 32 : 0));
+}
+
+// Function to find a keysym by its name, case-insensitively; used only at startup
+KeySym keysym_from_name(const char *name, size_t len) {
+    // A single character is the unshifted key that types it
+    if (len == 1 && isgraph((unsigned char)name[0])) {
+        return (KeySym)tolower((unsigned char)name[0]);
+    }
+
+    KeySym found = NoSymbol;
+    for (int i = 0; i < KEYSYM_NAME_COUNT; i++) {
+        const KeysymName *entry = &keysym_names[i];
+        if ((entry->name & 0xff) != len) {
+            continue;
+        }
+        const char *candidate = keysym_name_pool + (entry->name >> 8);
+        size_t c = 0;
+        while (c < len && toupper((unsigned char)name[c]) == candidate[c]) {
+            c++;
+        }
+        // Names are stored uppercased, so "agrave" matches both cases; the
+        // lowercase Latin-1 keysym is the higher one and is what the key sends
+        if (c == len && (found == NoSymbol || (entry->keysym < 0x100 && entry->keysym > found))) {
+            found = entry->keysym;
+        }
+    }
+    return found;
+}
+
+// Function to read the sequence definitions and compile them into the trie
+int sequence_load(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    // Node 0 is the root
+    sequence_node_count = 1;
+    sequence_nodes[0].label = -1;
+
+    char line[SEQUENCE_LINE_LENGTH];
+    int line_number = 0;
+    int status = 0;
+    while (status == 0 && fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+        char *p = line;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+
+        // "Find file = ctrl+x ctrl+f"
+        char *equals = strchr(p, '=');
+        if (equals == NULL) {
+            fprintf(stderr, "%s:%d: expected \"name = strokes\".\n", path, line_number);
+            status = -1;
+            break;
+        }
+        char *label_end = equals;
+        while (label_end > p && isspace((unsigned char)label_end[-1])) {
+            label_end--;
+        }
+        status = sequence_add(p, (size_t)(label_end - p), equals + 1, path, line_number);
+    }
+    fclose(file);
+
+    if (status == 0 && sequence_node_count == 1) {
+        fprintf(stderr, "%s: no sequences defined.\n", path);
+        status = -1;
+    }
+    if (status != 0) {
+        sequence_node_count = 0;
+    }
+    return status;
+}
+
+// Function to add one named sequence of whitespace-separated strokes to the trie
+int sequence_add(const char *label, size_t label_len, char *strokes, const char *path, int line) {
+    if (label_len == 0 || label_len > MAX_FRAME_MESSAGE - SOURCE_TAG_LENGTH - 1) {
+        fprintf(stderr, "%s:%d: the name must be 1-%d characters.\n", path, line, MAX_FRAME_MESSAGE - SOURCE_TAG_LENGTH - 1);
+        return -1;
+    }
+
+    int node = 0;
+    char *save = NULL;
+    for (char *stroke = strtok_r(strokes, " \t\r\n", &save); stroke != NULL; stroke = strtok_r(NULL, " \t\r\n", &save)) {
+        // Modifiers come before the last '+', the key after it
+        char *plus = strrchr(stroke, '+');
+        const char *key_name = plus != NULL ? plus + 1 : stroke;
+        ModifierState mask = 0;
+        if (plus != NULL) {
+            *plus = '\0';
+            if (parse_modifier_list(stroke, &mask) != 0) {
+                fprintf(stderr, "%s:%d: unknown modifier in \"%s\".\n", path, line, stroke);
+                return -1;
+            }
+        }
+        KeySym keysym = keysym_from_name(key_name, strlen(key_name));
+        if (keysym == NoSymbol) {
+            fprintf(stderr, "%s:%d: unknown key \"%s\".\n", path, line, key_name);
+            return -1;
+        }
+
+        int child = sequence_child(node, modifier_kinds(mask), (uint32_t)keysym);
+        if (child == 0) {
+            child = sequence_add_child(node, modifier_kinds(mask), (uint32_t)keysym);
+            if (child == 0) {
+                fprintf(stderr, "%s:%d: too many sequences.\n", path, line);
+                return -1;
+            }
+        }
+        node = child;
+    }
+
+    if (node == 0) {
+        fprintf(stderr, "%s:%d: no strokes given.\n", path, line);
+        return -1;
+    }
+    if (sequence_nodes[node].label != -1) {
+        fprintf(stderr, "%s:%d: this sequence is already defined.\n", path, line);
+        return -1;
+    }
+    if (label_len > sizeof(sequence_labels) - sequence_labels_used) {
+        fprintf(stderr, "%s:%d: too many sequences.\n", path, line);
+        return -1;
+    }
+    memcpy(sequence_labels + sequence_labels_used, label, label_len);
+    sequence_nodes[node].label = (int32_t)sequence_labels_used;
+    sequence_nodes[node].label_len = (uint16_t)label_len;
+    sequence_labels_used += label_len;
+    return 0;
+}
+
+// Function to follow the edge for a stroke, returning 0 if there is none
+int sequence_child(int node, uint8_t kinds, uint32_t keysym) {
+    uint32_t slot = keysym_hash(keysym, (uint32_t)node << 8 | kinds) & (SEQUENCE_EDGE_SLOTS - 1);
+    while (sequence_edges[slot].child != 0) {
+        const SequenceEdge *edge = &sequence_edges[slot];
+        if (edge->parent == node && edge->kinds == kinds && edge->keysym == keysym) {
+            return edge->child;
+        }
+        slot = (slot + 1) & (SEQUENCE_EDGE_SLOTS - 1);
+    }
+    return 0;
+}
+
+// Function to create a node under another for a stroke, returning 0 when full
+int sequence_add_child(int node, uint8_t kinds, uint32_t keysym) {
+    if (sequence_node_count >= SEQUENCE_MAX_NODES) {
+        return 0;
+    }
+    int child = sequence_node_count++;
+    sequence_nodes[child].label = -1;
+    sequence_nodes[node].children++;
+
+    // Never more than half full, so there is always a free slot
+    uint32_t slot = keysym_hash(keysym, (uint32_t)node << 8 | kinds) & (SEQUENCE_EDGE_SLOTS - 1);
+    while (sequence_edges[slot].child != 0) {
+        slot = (slot + 1) & (SEQUENCE_EDGE_SLOTS - 1);
+    }
+    SequenceEdge *edge = &sequence_edges[slot];
+    edge->keysym = keysym;
+    edge->parent = (uint16_t)node;
+    edge->kinds = kinds;
+    edge->child = (uint16_t)child;
+    return child;
+}
+
+// Function to advance the matcher by a formatted record; returns 1 if its frame
+// is held back, and rewrites message and key when it completes a sequence
+int sequence_advance(const EventRecord *record, char *message, uint64_t *key) {
+    // A sequence is typed on one display; the others are drawn as usual meanwhile
+    if (sequence_node != 0 && record->source != sequence_source) {
+        return 0;
+    }
+
+    if (record->type != KeyPress) {
+        // A click ends any sequence in progress
+        if (sequence_node != 0) {
+            sequence_break();
+        }
+        return 0;
+    }
+
+    // Modifiers pressed between strokes draw nothing while a sequence is in progress
+    if (keysym_to_modifier_bit(record->keysym) != 0) {
+        return sequence_node != 0;
+    }
+
+    uint8_t kinds = modifier_kinds(record->modifiers);
+    if (sequence_node != 0 && record->server_time - sequence_time > sequence_timeout) {
+        sequence_break(); // The timer has not fired yet, but the server clock says it should have
+    }
+    int child = sequence_child(sequence_node, kinds, record->keysym);
+    if (child == 0 && sequence_node != 0) {
+        sequence_break();
+        child = sequence_child(0, kinds, record->keysym); // A broken sequence may start another
+    }
+    if (child == 0) {
+        return 0;
+    }
+    sequence_time = record->server_time;
+    sequence_source = record->source;
+
+    // Longer sequences start here; keep the stroke until the next one or the timeout
+    if (sequence_nodes[child].children > 0) {
+        sequence_node = child;
+        memcpy(sequence_held_message, message, sizeof(sequence_held_message));
+        sequence_held_key = *key;
+        sequence_arm_timer(sequence_timeout);
+        return 1;
+    }
+
+    sequence_node = 0;
+    sequence_arm_timer(0);
+    sequence_label_message(child, record->source, message, key);
+    return 0;
+}
+
+// Function to write a completed sequence's name, tagged like any other message
+void sequence_label_message(int node, int source, char *message, uint64_t *key) {
+    const SequenceNode *done = &sequence_nodes[node];
+    char *p = message;
+    if (show_source_tags) {
+        memcpy(p, sources[source].tag, sources[source].tag_len);
+        p += sources[source].tag_len;
+    }
+    memcpy(p, sequence_labels + done->label, done->label_len);
+    p[done->label_len] = '\0';
+
+    // Outside the range of record_repeat_key(), so repeating a sequence is counted too
+    *key = (1ULL << 63) | ((uint64_t)source << 16) | (uint64_t)node;
+}
+
+// Function to arm the sequence timeout, or disarm it with 0
+void sequence_arm_timer(unsigned int ms) {
+    struct itimerspec its = {{0, 0}, {ms / 1000, (long)(ms % 1000) * 1000000L}};
+    timerfd_settime(sequence_timer_fd, 0, &its, NULL);
+}
+
+// Function to show what an unfinished sequence had reached: its own name if the
+// prefix is itself a sequence, otherwise the stroke that was held back
+void sequence_expire(void) {
+    if (sequence_node == 0) {
+        return;
+    }
+
+    const SequenceNode *node = &sequence_nodes[sequence_node];
+    uint64_t key = sequence_held_key;
+    if (node->label != -1) {
+        sequence_label_message(sequence_node, sequence_source, pending_message, &key);
+    } else {
+        memcpy(pending_message, sequence_held_message, sizeof(pending_message));
+    }
+    sequence_node = 0;
+
+    pending_repeat = 1;
+    pending_new_message = 1;
+    pending_repeat_only = 0;
+    last_repeat_key = key;
+    last_repeat_time = sequence_time;
+}
+
+// Function to end a sequence broken by a stroke that does not continue it. The
+// held stroke is drawn first, as a timeout would, so that the breaking stroke
+// replaces it on screen and pushes it into the history like any other combo
+void sequence_break(void) {
+    sequence_expire();
+    sequence_arm_timer(0);
+
+    // The breaking stroke is already counted; it belongs to the next frame
+    pending_records--;
+    flush_pending_frame();
+    pending_records++;
+}
+
+// Function to build the display text for a record; returns 0 if it draws nothing
+int format_record(const EventRecord *record, char *message) {
+    const CaptureSource *source = &sources[record->source];
+    char *p = message;
+
+    // With several displays, every message says which one it came from
+    if (show_source_tags) {
+        memcpy(p, source->tag, source->tag_len);
+        p += source->tag_len;
+    }
+
+    // Mouse event handling
+    if (record->type == ButtonPress) {
+        const char *button_name = mouse_button_to_name(record->detail);
+        snprintf(p, MAX_FRAME_MESSAGE - (size_t)(p - message), "%s", button_name);
+        return 1;
+    }
+
+    // Only key presses with a printable name produce a frame
+    if (record->type != KeyPress) {
+        return 0;
+    }
+    const KeyLabel *key = record_key_label(record);
+    if (key->len == 0) {
+        return 0;
+    }
+
+    // Handle mouse button pressed along with key
+    if (record->mouse_button != 0) {
+        const char *button_name = mouse_button_to_name(record->mouse_button);
+        size_t button_len = strlen(button_name);
+        memcpy(p, button_name, button_len);
+        memcpy(p + button_len, " + ", 3);
+        p += button_len + 3;
+    }
+
+    // Held modifiers, except the key itself when it is a modifier
+    const ModifierPrefix *prefix = modifier_prefix(record->modifiers & (ModifierState)~key->modifier_bit);
+    memcpy(p, prefix->text, prefix->len);
+    p += prefix->len;
+
+    memcpy(p, key->label, key->len);
+    p[key->len] = '\0';
+    return 1;
+}
+
+// Function to get the label of a record's keysym on the render thread. The
+// keymap tables belong to the capture side and may be rebuilt at any moment;
+// a label depends only on the keysym, so it is resolved here and memoized
+const KeyLabel *record_key_label(const EventRecord *record) {
+    KeyLabel *key = &render_key_labels[keysym_hash(record->keysym, 0) & (RENDER_LABEL_SLOTS - 1)];
+    if (key->keysym != record->keysym) {
+        fill_key_label(key, record->keysym);
+    }
+    return key;
+}
+
+// Function to bump a counter that only the calling thread writes
+void stat_add(atomic_ulong *counter, unsigned long n) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + n,
+                          memory_order_relaxed);
+}
+
+// Function to map a latency in microseconds to its histogram bucket
+int latency_bucket(uint64_t us) {
+    if (us < 16) {
+        return (int)us;
+    }
+    int exponent = 63 - __builtin_clzll(us);
+    if (exponent > 31) {
+        return LATENCY_BUCKETS - 1;
+    }
+    return 16 + (exponent - 4) * 8 + (int)((us >> (exponent - 3)) & 7);
+}
+
+// Function to get the smallest latency that falls in a bucket
+uint64_t latency_bucket_floor(int bucket) {
+    if (bucket < 16) {
+        return (uint64_t)bucket;
+    }
+    int exponent = 4 + (bucket - 16) / 8;
+    return (uint64_t)(8 + (bucket - 16) % 8) << (exponent - 3);
+}
+
+// Render thread: record how long ago the server saw the event now on screen
+void stats_record_latency(uint32_t server_time) {
+    if (replay_path != NULL) {
+        return; // Recorded timestamps say nothing about this run
+    }
+
+    // X servers on Linux take server_time from CLOCK_MONOTONIC in milliseconds
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint32_t now_ms = (uint32_t)((uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000);
+    uint32_t delta_ms = now_ms - server_time;
+    if (delta_ms > LATENCY_MAX_MS) {
+        stat_add(&latency_unmatched, 1);
+        return;
+    }
+
+    uint64_t us = (uint64_t)delta_ms * 1000 + (uint64_t)(now.tv_nsec / 1000) % 1000;
+    stat_add(&latency_histogram[latency_bucket(us)], 1);
+}
+
+// Function to write all counters and latency percentiles to stderr or the stats file
+void dump_stats(void) {
+    FILE *out = stderr;
+    if (stats_path != NULL) {
+        out = fopen(stats_path, "a");
+        if (out == NULL) {
+            perror(stats_path);
+            return;
+        }
+    }
+
+    fprintf(out, "termkey stats:\n");
+    fprintf(out, "  events: key press %lu, key release %lu, button press %lu, button release %lu\n",
+            (unsigned long)event_counts[0], (unsigned long)event_counts[1],
+            (unsigned long)event_counts[2], (unsigned long)event_counts[3]);
+    fprintf(out, "  frames: rendered %lu, coalesced %lu, bytes written %lu\n",
+            (unsigned long)frame_count, (unsigned long)frames_coalesced,
+            (unsigned long)frame_bytes_total);
+    fprintf(out, "  ring: pushed %lu, dropped %lu, high-water %zu/%d\n",
+            (unsigned long)ring_pushed, (unsigned long)ring_dropped,
+            (size_t)ring_high_water, EVENT_RING_SIZE);
+    fprintf(out, "  wakeups: loop %lu, render %lu\n",
+            (unsigned long)loop_wakeups, (unsigned long)render_wakeups);
+    if (filter_active) {
+        fprintf(out, "  filter: key events dropped %lu\n", (unsigned long)events_filtered);
+    }
+    if (stream_addr != NULL) {
+        fprintf(out, "  stream: packets %lu, send errors %lu\n",
+                (unsigned long)stream_packets, (unsigned long)stream_send_errors);
+    }
+
+    // Percentiles are the lower bound of the bucket they fall in
+    unsigned long counts[LATENCY_BUCKETS];
+    unsigned long total = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        counts[i] = latency_histogram[i];
+        total += counts[i];
+    }
+    fprintf(out, "  latency (server -> frame written): %lu samples, %lu unmatched\n",
+            total, (unsigned long)latency_unmatched);
+    if (total > 0) {
+        static const double percentiles[] = {50.0, 90.0, 99.0, 99.9};
+        fprintf(out, "   ");
+        for (size_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+            unsigned long rank = (unsigned long)((double)total * percentiles[p] / 100.0);
+            unsigned long seen = 0;
+            int bucket = 0;
+            while (bucket < LATENCY_BUCKETS - 1 && seen + counts[bucket] <= rank) {
+                seen += counts[bucket];
+                bucket++;
+            }
+            fprintf(out, " p%g %.3f ms", percentiles[p], (double)latency_bucket_floor(bucket) / 1000.0);
+        }
+        int max_bucket = LATENCY_BUCKETS - 1;
+        while (max_bucket > 0 && counts[max_bucket] == 0) {
+            max_bucket--;
+        }
+        fprintf(out, " max >= %.3f ms\n", (double)latency_bucket_floor(max_bucket) / 1000.0);
+    }
+
+    if (show_heatmap) {
+        print_key_heatmap(out);
+    }
+
+    if (out != stderr) {
+        fclose(out);
+    }
+}
+
+// Function to count a key or button press for the usage statistics; O(1)
+void key_stats_add(const EventRecord *record) {
+    if (record->type == ButtonPress) {
+        stat_add(&button_counts[record->detail & (KEY_STATS_BUTTONS - 1)], 1);
+        return;
+    }
+    if (record->type != KeyPress) {
+        return;
+    }
+
+    ModifierState modifier_bit = keysym_to_modifier_bit(record->keysym);
+    ModifierState mask = record->modifiers & (ModifierState)~modifier_bit;
+    stat_add(&key_counts[record->detail], 1);
+    atomic_store_explicit(&key_keysyms[record->detail], record->keysym, memory_order_relaxed);
+    stat_add(&modifier_mask_counts[mask & (MODIFIER_COMBINATIONS - 1)], 1);
+
+    // Only shortcuts go into the combo table; plain keys are already in key_counts
+    if (mask == 0 || modifier_bit != 0) {
+        return;
+    }
+
+    uint32_t id = ((uint32_t)record->source << 19 | (uint32_t)mask << 8 | record->detail) + 1;
+    uint32_t slot = keysym_hash(id, 0) & (COMBO_SLOTS - 1);
+    for (int probe = 0; probe < COMBO_MAX_PROBES; probe++) {
+        ComboSlot *combo = &combo_slots[slot];
+        uint32_t found = atomic_load_explicit(&combo->key, memory_order_relaxed);
+        if (found == id) {
+            stat_add(&combo->count, 1);
+            return;
+        }
+        if (found == 0) {
+            // The count and keysym are in place before the exporter can see the key
+            atomic_store_explicit(&combo->count, 1, memory_order_relaxed);
+            atomic_store_explicit(&combo->keysym, record->keysym, memory_order_relaxed);
+            atomic_store_explicit(&combo->key, id, memory_order_release);
+            return;
+        }
+        slot = (slot + 1) & (COMBO_SLOTS - 1);
+    }
+    stat_add(&combo_overflow, 1);
+}
+
+// Function to start the thread that exports the key statistics periodically
+int key_stats_open(void) {
+    key_stats_wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (key_stats_wake_fd == -1) {
+        perror("eventfd");
+        return -1;
+    }
+
+    key_stats_running = 1;
+    if (pthread_create(&key_stats_thread, NULL, key_stats_main, NULL) != 0) {
+        fprintf(stderr, "Error starting key statistics thread.\n");
+        key_stats_running = 0;
+        close(key_stats_wake_fd);
+        key_stats_wake_fd = -1;
+        return -1;
+    }
+    return 0;
+}
+
+// Function to stop the exporter and write the final statistics
+void key_stats_close(void) {
+    if (!key_stats_running) {
+        return;
+    }
+
+    key_stats_running = 0;
+    uint64_t one = 1;
+    if (write(key_stats_wake_fd, &one, sizeof(one)) == (ssize_t)sizeof(one)) {
+        pthread_join(key_stats_thread, NULL);
+    }
+    close(key_stats_wake_fd);
+    key_stats_wake_fd = -1;
+
+    key_stats_write(key_stats_path);
+}
+
+// Exporter thread: rewrite the statistics file every key_stats_interval seconds
+void *key_stats_main(void *arg) {
+    (void)arg;
+    struct pollfd fd = {key_stats_wake_fd, POLLIN, 0};
+
+    while (key_stats_running) {
+        int ready = poll(&fd, 1, (int)key_stats_interval * 1000);
+        if (ready == -1 && errno != EINTR) {
+            break;
+        }
+        if (ready == 0) {
+            key_stats_write(key_stats_path);
         }
     }
-    // If not, convert to default string
-    return XKeysymToString(keysym);
+    return NULL;
 }
 
-// Function to print usage instructions
-void print_usage(const char *prog_name) {
-    printf("Usage: %s [-c bg_color [fg_color [letter_color]]]\n", prog_name);
-    printf("Available colors: black, red, green, yellow, blue, magenta, cyan, white, default\n");
-    printf("Examples:\n");
-    printf("  %s -c red blue             # Background red, foreground blue\n", prog_name);
-    printf("  %s -c red default          # Background red, foreground default\n", prog_name);
-    printf("  %s -c default green        # Background default, foreground green\n", prog_name);
-    printf("  %s -c default default red  # Only letters colored red\n", prog_name);
-    printf("  %s -c                      # Display this help message\n", prog_name);
-    exit(EXIT_SUCCESS);
+// Function to write a label as a quoted CSV field or JSON string
+void key_stats_put_text(FILE *out, const char *text, size_t len, int json) {
+    fputc('"', out);
+    for (size_t i = 0; i < len; i++) {
+        if (text[i] == '"') {
+            fputs(json ? "\\\"" : "\"\"", out);
+        } else if (text[i] == '\\' && json) {
+            fputs("\\\\", out);
+        } else {
+            fputc(text[i], out);
+        }
+    }
+    fputc('"', out);
 }
 
-// Function to update the modifier keys state
-void update_modifier_state(KeySym keysym, int is_key_press) {
-    switch (keysym) {
-        case XK_Shift_L:          modifiers.shift_l   = is_key_press; break;
-        case XK_Shift_R:          modifiers.shift_r   = is_key_press; break;
-        case XK_Control_L:        modifiers.ctrl_l    = is_key_press; break;
-        case XK_Control_R:        modifiers.ctrl_r    = is_key_press; break;
-        case XK_Alt_L:            modifiers.alt_l     = is_key_press; break;
-        case XK_Alt_R:            modifiers.alt_r     = is_key_press; break;
-        case XK_Meta_L:           modifiers.meta_l    = is_key_press; break;
-        case XK_Meta_R:           modifiers.meta_r    = is_key_press; break;
-        case XK_ISO_Level3_Shift: modifiers.altgr     = is_key_press; break;
-        case XK_Super_L:          modifiers.super_l   = is_key_press; break;
-        case XK_Super_R:          modifiers.super_r   = is_key_press; break;
-        default: break;
+// Function to write a modifier mask as "CONTROL_L + SHIFT_L", quoted
+void key_stats_put_modifiers(FILE *out, ModifierState mask, int json) {
+    // Built here rather than through modifier_prefix(), whose cache belongs to the render thread
+    char text[MODIFIER_PREFIX_LENGTH];
+    size_t len = 0;
+    for (int i = 0; i < MODIFIER_COUNT; i++) {
+        if (mask & (1 << i)) {
+            size_t name_len = strlen(modifier_names[i]);
+            memcpy(text + len, modifier_names[i], name_len);
+            len += name_len;
+        }
     }
+    key_stats_put_text(out, text, len >= 3 ? len - 3 : 0, json);
 }
 
-// Callback function to process intercepted events
-void event_callback(XPointer priv, XRecordInterceptData *data) {
-    if (data->category == XRecordFromServer && data->data != NULL) {
-        xEvent *event = (xEvent *)data->data;
-        char message[MAX_MESSAGE_LENGTH * 2 + 10] = ""; // Adjusted buffer size
-
-        // Get the event type
-        int event_type = event->u.u.type & 0x7F; // Ignore the send_event bit
-
-        // Mouse event handling
-        if (event_type == ButtonPress) {
-            mouse_button_pressed = event->u.u.detail; // The detail field contains the button number
-            const char *button_name = mouse_button_to_name(mouse_button_pressed);
-            snprintf(message, sizeof(message), "%s", button_name);
-            print_centered(message);
-        } else if (event_type == ButtonRelease) {
-            mouse_button_pressed = 0; // Mouse button released
-        }
-        // Keyboard event handling
-        else if (event_type == KeyPress || event_type == KeyRelease) {
-            unsigned int keycode = event->u.u.detail;
-            KeySym keysym = XkbKeycodeToKeysym(display, keycode, 0, 0);
-
-            // Update the state of modifier keys
-            int is_key_press = (event_type == KeyPress);
-            update_modifier_state(keysym, is_key_press);
-
-            // Process the key if it's a KeyPress event
-            if (is_key_press) {
-                const char *key_string = keysym_to_string(keysym);
-
-                if (key_string != NULL) {
-                    char uppercase_key[MAX_MESSAGE_LENGTH];
-                    // Copy key_string to uppercase_key and convert to uppercase
-                    strncpy(uppercase_key, key_string, sizeof(uppercase_key) - 1);
-                    uppercase_key[sizeof(uppercase_key) - 1] = '\0'; // Ensure null termination
-
-                    for (int i = 0; uppercase_key[i]; i++) {
-                        uppercase_key[i] = toupper((unsigned char)uppercase_key[i]);
-                    }
-
-                    // Check if the key is a modifier key
-                    int is_modifier_key = (keysym == XK_Shift_L || keysym == XK_Shift_R ||
-                                           keysym == XK_Control_L || keysym == XK_Control_R ||
-                                           keysym == XK_Alt_L || keysym == XK_Alt_R ||
-                                           keysym == XK_Meta_L || keysym == XK_Meta_R ||
-                                           keysym == XK_ISO_Level3_Shift ||
-                                           keysym == XK_Super_L || keysym == XK_Super_R);
-
-                    char modifiers_message[MAX_MESSAGE_LENGTH] = "";
-
-                    // Include specific modifiers if they are pressed and are not the current key
-                    if (modifiers.ctrl_l && keysym != XK_Control_L)
-                        strncat(modifiers_message, "CONTROL_L + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.ctrl_r && keysym != XK_Control_R)
-                        strncat(modifiers_message, "CONTROL_R + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.alt_l && keysym != XK_Alt_L)
-                        strncat(modifiers_message, "ALT_L + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.alt_r && keysym != XK_Alt_R)
-                        strncat(modifiers_message, "ALT_R + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.shift_l && keysym != XK_Shift_L)
-                        strncat(modifiers_message, "SHIFT_L + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.shift_r && keysym != XK_Shift_R)
-                        strncat(modifiers_message, "SHIFT_R + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.meta_l && keysym != XK_Meta_L)
-                        strncat(modifiers_message, "META_L + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.meta_r && keysym != XK_Meta_R)
-                        strncat(modifiers_message, "META_R + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.altgr && keysym != XK_ISO_Level3_Shift)
-                        strncat(modifiers_message, "ALTGR + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.super_l && keysym != XK_Super_L)
-                        strncat(modifiers_message, "SUPER_L + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    if (modifiers.super_r && keysym != XK_Super_R)
-                        strncat(modifiers_message, "SUPER_R + ", sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-
-                    // Add the key pressed
-                    if (!(is_modifier_key && modifiers_message[0] == '\0')) {
-                        // If the key is not a lone modifier, add it to the message
-                        strncat(modifiers_message, uppercase_key, sizeof(modifiers_message) - strlen(modifiers_message) - 1);
-                    } else {
-                        // If it's a lone modifier, just use its name
-                        strncpy(modifiers_message, uppercase_key, sizeof(modifiers_message) - 1);
-                        modifiers_message[sizeof(modifiers_message) - 1] = '\0';
-                    }
-
-                    // Handle mouse button pressed along with key
-                    if (mouse_button_pressed != 0) {
-                        const char *button_name = mouse_button_to_name(mouse_button_pressed);
-                        snprintf(message, sizeof(message), "%s + %s", button_name, modifiers_message);
-                    } else {
-                        strncpy(message, modifiers_message, sizeof(message) - 1);
-                        message[sizeof(message) - 1] = '\0'; // Ensure null termination
-                    }
-
-                    print_centered(message);
+// Function to write every non-zero counter to path, replacing it atomically
+int key_stats_write(const char *path) {
+    size_t path_len = strlen(path);
+    int json = path_len >= 5 && strcmp(path + path_len - 5, ".json") == 0;
+
+    char tmp_path[PATH_MAX];
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int)sizeof(tmp_path)) {
+        fprintf(stderr, "%s: file name too long.\n", path);
+        return -1;
+    }
+    FILE *out = fopen(tmp_path, "w");
+    if (out == NULL) {
+        perror(tmp_path);
+        return -1;
+    }
+
+    // Keymap tables belong to the capture thread; labels are rebuilt from the stored keysyms
+    KeyLabel key;
+    const char *separator = "";
+
+    fputs(json ? "{\"keys\":[" : "kind,source,code,label,modifiers,count\n", out);
+    for (int keycode = 0; keycode < MAX_KEYCODES; keycode++) {
+        unsigned long count = key_counts[keycode];
+        if (count == 0) {
+            continue;
+        }
+        fill_key_label(&key, atomic_load_explicit(&key_keysyms[keycode], memory_order_relaxed));
+        if (json) {
+            fprintf(out, "%s\n{\"keycode\":%d,\"label\":", separator, keycode);
+            key_stats_put_text(out, key.label, key.len, 1);
+            fprintf(out, ",\"count\":%lu}", count);
+            separator = ",";
+        } else {
+            fprintf(out, "key,,%d,", keycode);
+            key_stats_put_text(out, key.label, key.len, 0);
+            fprintf(out, ",,%lu\n", count);
+        }
+    }
+
+    separator = "";
+    fputs(json ? "],\n\"modifiers\":[" : "", out);
+    for (int mask = 0; mask < MODIFIER_COMBINATIONS; mask++) {
+        unsigned long count = modifier_mask_counts[mask];
+        if (count == 0) {
+            continue;
+        }
+        if (json) {
+            fprintf(out, "%s\n{\"modifiers\":", separator);
+            key_stats_put_modifiers(out, (ModifierState)mask, 1);
+            fprintf(out, ",\"count\":%lu}", count);
+            separator = ",";
+        } else {
+            fputs("modifiers,,,,", out);
+            key_stats_put_modifiers(out, (ModifierState)mask, 0);
+            fprintf(out, ",%lu\n", count);
+        }
+    }
+
+    separator = "";
+    fputs(json ? "],\n\"combos\":[" : "", out);
+    for (int slot = 0; slot < COMBO_SLOTS; slot++) {
+        uint32_t id = atomic_load_explicit(&combo_slots[slot].key, memory_order_acquire);
+        if (id == 0) {
+            continue;
+        }
+        id -= 1;
+        int source = (int)(id >> 19);
+        int keycode = (int)(id & 0xff);
+        ModifierState mask = (ModifierState)((id >> 8) & (MODIFIER_COMBINATIONS - 1));
+        unsigned long count = atomic_load_explicit(&combo_slots[slot].count, memory_order_relaxed);
+        fill_key_label(&key, atomic_load_explicit(&combo_slots[slot].keysym, memory_order_relaxed));
+        if (json) {
+            fprintf(out, "%s\n{\"source\":%d,\"keycode\":%d,\"label\":", separator, source, keycode);
+            key_stats_put_text(out, key.label, key.len, 1);
+            fputs(",\"modifiers\":", out);
+            key_stats_put_modifiers(out, mask, 1);
+            fprintf(out, ",\"count\":%lu}", count);
+            separator = ",";
+        } else {
+            fprintf(out, "combo,%d,%d,", source, keycode);
+            key_stats_put_text(out, key.label, key.len, 0);
+            fputc(',', out);
+            key_stats_put_modifiers(out, mask, 0);
+            fprintf(out, ",%lu\n", count);
+        }
+    }
+
+    separator = "";
+    fputs(json ? "],\n\"buttons\":[" : "", out);
+    for (int button = 1; button < KEY_STATS_BUTTONS; button++) {
+        unsigned long count = button_counts[button];
+        if (count == 0) {
+            continue;
+        }
+        const char *name = mouse_button_to_name(button);
+        if (json) {
+            fprintf(out, "%s\n{\"button\":%d,\"label\":", separator, button);
+            key_stats_put_text(out, name, strlen(name), 1);
+            fprintf(out, ",\"count\":%lu}", count);
+            separator = ",";
+        } else {
+            fprintf(out, "button,,%d,", button);
+            key_stats_put_text(out, name, strlen(name), 0);
+            fprintf(out, ",,%lu\n", count);
+        }
+    }
+    if (json) {
+        fprintf(out, "],\n\"combo_overflow\":%lu}\n", (unsigned long)combo_overflow);
+    }
+
+    if (fclose(out) != 0 || rename(tmp_path, path) != 0) {
+        perror(path);
+        unlink(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to draw the key counts on a US keyboard layout, hotter keys in warmer colours
+void print_key_heatmap(FILE *out) {
+    // Rows in evdev codes; X keycodes are evdev codes + 8 on evdev-based servers
+    static const struct {
+        int indent;
+        unsigned char keys[16];
+    } rows[] = {
+        {0, {KEY_ESC, KEY_F1, KEY_F2, KEY_F3, KEY_F4, KEY_F5, KEY_F6, KEY_F7, KEY_F8, KEY_F9, KEY_F10, KEY_F11, KEY_F12}},
+        {0, {KEY_GRAVE, KEY_1, KEY_2, KEY_3, KEY_4, KEY_5, KEY_6, KEY_7, KEY_8, KEY_9, KEY_0, KEY_MINUS, KEY_EQUAL, KEY_BACKSPACE}},
+        {3, {KEY_TAB, KEY_Q, KEY_W, KEY_E, KEY_R, KEY_T, KEY_Y, KEY_U, KEY_I, KEY_O, KEY_P, KEY_LEFTBRACE, KEY_RIGHTBRACE, KEY_BACKSLASH}},
+        {4, {KEY_CAPSLOCK, KEY_A, KEY_S, KEY_D, KEY_F, KEY_G, KEY_H, KEY_J, KEY_K, KEY_L, KEY_SEMICOLON, KEY_APOSTROPHE, KEY_ENTER}},
+        {6, {KEY_LEFTSHIFT, KEY_Z, KEY_X, KEY_C, KEY_V, KEY_B, KEY_N, KEY_M, KEY_COMMA, KEY_DOT, KEY_SLASH, KEY_RIGHTSHIFT}},
+        {0, {KEY_LEFTCTRL, KEY_LEFTMETA, KEY_LEFTALT, KEY_SPACE, KEY_RIGHTALT, KEY_RIGHTMETA, KEY_COMPOSE, KEY_RIGHTCTRL}}
+    };
+    // 256-colour backgrounds from unused through green and yellow to red
+    static const int heat[] = {236, 22, 28, 34, 70, 142, 178, 214, 208, 202, 196};
+    const int levels = (int)(sizeof(heat) / sizeof(heat[0]));
+
+    unsigned long max = 0;
+    for (int keycode = 0; keycode < MAX_KEYCODES; keycode++) {
+        if (key_counts[keycode] > max) {
+            max = key_counts[keycode];
+        }
+    }
+
+    KeyLabel key;
+    fprintf(out, "  key heatmap (hottest key %lu presses):\n", max);
+    for (size_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+        fprintf(out, "  %*s", rows[r].indent, "");
+        for (int k = 0; k < 16 && rows[r].keys[k] != 0; k++) {
+            int keycode = rows[r].keys[k] + 8;
+            unsigned long count = key_counts[keycode];
+            // Pressed keys spread over levels 1..levels-1; only the hottest reaches the top
+            int level = count == 0 ? 0 : 1 + (int)((count * (unsigned long)(levels - 2)) / max);
+
+            // Keys never pressed are named from the built-in US layout
+            KeySym keysym = atomic_load_explicit(&key_keysyms[keycode], memory_order_relaxed);
+            for (size_t i = 0; keysym == NoSymbol && i < EVDEV_KEYMAP_SIZE; i++) {
+                if (evdev_keymap[i].code == rows[r].keys[k]) {
+                    keysym = evdev_keymap[i].keysym;
                 }
             }
+
+            // "SLASH (/)" is shown as "/", anything else cut to fit the cell
+            fill_key_label(&key, keysym);
+            const char *label = key.label;
+            size_t len = key.len;
+            const char *open = strstr(label, " (");
+            if (open != NULL && len > 0 && label[len - 1] == ')') {
+                label = open + 2;
+                len = (size_t)(key.label + len - 1 - label);
+            }
+            fprintf(out, "\033[48;5;%dm %-5.*s\033[0m", heat[level], (int)(len < 5 ? len : 5), label);
         }
+        fputc('\n', out);
     }
-
-    // Free the intercepted event data
-    XRecordFreeData(data);
 }
 
 // Cleanup function to restore cursor and close displays
 void cleanup(void) {
-    enable_cursor();
-    if (display) {
-        XCloseDisplay(display);
-        display = NULL;
+    if (display_enabled) {
+        enable_cursor();
+    }
+    if (stats_at_exit) {
+        dump_stats();
+        stats_at_exit = 0;
+    }
+    input_source->close();
+    stream_close();
+    bus_unmap();
+    log_close();
+    key_stats_close();
+#ifdef TERMKEY_TRACE
+    trace_close();
+#endif
+    for (int i = 0; i < source_count; i++) {
+        if (sources[i].display) {
+            XCloseDisplay(sources[i].display);
+            sources[i].display = NULL;
+        }
+        if (sources[i].record_display) {
+            XCloseDisplay(sources[i].record_display);
+            sources[i].record_display = NULL;
+        }
+    }
+    if (epoll_fd != -1) {
+        close(epoll_fd);
+        epoll_fd = -1;
+    }
+    if (signal_fd != -1) {
+        close(signal_fd);
+        signal_fd = -1;
+    }
+    if (timer_fd != -1) {
+        close(timer_fd);
+        timer_fd = -1;
+    }
+    if (render_wake_fd != -1) {
+        close(render_wake_fd);
+        render_wake_fd = -1;
+    }
+    if (render_timer_fd != -1) {
+        close(render_timer_fd);
+        render_timer_fd = -1;
+    }
+    if (sequence_timer_fd != -1) {
+        close(sequence_timer_fd);
+        sequence_timer_fd = -1;
+    }
+}
+
+// Function to read CLOCK_MONOTONIC in nanoseconds
+uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef TERMKEY_TRACE
+// Function to create the trace file and start the thread that fills it
+int trace_open(const char *path) {
+    trace_file = fopen(path, "w");
+    if (trace_file == NULL) {
+        perror(path);
+        return -1;
+    }
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", trace_file);
+
+    trace_wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (trace_wake_fd == -1) {
+        perror("eventfd");
+        fclose(trace_file);
+        trace_file = NULL;
+        return -1;
+    }
+
+    trace_running = 1;
+    if (pthread_create(&trace_thread, NULL, trace_flush_main, NULL) != 0) {
+        fprintf(stderr, "Error starting trace thread.\n");
+        trace_running = 0;
+        close(trace_wake_fd);
+        trace_wake_fd = -1;
+        fclose(trace_file);
+        trace_file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+// Function to give the calling thread its own trace buffer
+void trace_register(const char *name) {
+    if (trace_file == NULL || trace_buffer != NULL) {
+        return;
+    }
+    int index = atomic_fetch_add(&trace_buffer_count, 1);
+    if (index >= TRACE_MAX_THREADS) {
+        return;
+    }
+    trace_buffer = &trace_buffers[index];
+    trace_buffer->tid = (int)syscall(SYS_gettid);
+    trace_buffer->thread_name = name;
+}
+
+// Function to record a stage boundary; no syscall unless a buffer half fills up
+void trace_event(const char *name, char phase) {
+    TraceBuffer *buffer = trace_buffer;
+    if (buffer == NULL) {
+        return;
+    }
+
+    int half = buffer->current;
+    if (atomic_load_explicit(&buffer->full[half], memory_order_acquire)) {
+        stat_add(&buffer->dropped, 1);
+        return;
+    }
+
+    TraceEvent *event = &buffer->events[half][buffer->used[half]++];
+    event->name = name;
+    event->ts = monotonic_ns();
+    event->phase = phase;
+
+    // Hand the full half to the flusher and carry on in the other one
+    if (buffer->used[half] == TRACE_HALF_EVENTS) {
+        atomic_store_explicit(&buffer->full[half], 1, memory_order_release);
+        buffer->current = half ^ 1;
+        uint64_t one = 1;
+        ssize_t n = write(trace_wake_fd, &one, sizeof(one));
+        (void)n;
+    }
+}
+
+// Function to write one buffer half as Chrome trace events
+void trace_write_half(TraceBuffer *buffer, int half) {
+    for (size_t i = 0; i < buffer->used[half]; i++) {
+        const TraceEvent *event = &buffer->events[half][i];
+        fprintf(trace_file, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":%d,\"tid\":%d}",
+                trace_first_event ? "" : ",\n", event->name, event->phase,
+                (unsigned long long)(event->ts / 1000), (unsigned long long)(event->ts % 1000),
+                (int)getpid(), buffer->tid);
+        trace_first_event = 0;
+    }
+    buffer->used[half] = 0;
+}
+
+// Trace thread: write out buffer halves as the traced threads fill them
+void *trace_flush_main(void *arg) {
+    (void)arg;
+
+    while (trace_running) {
+        uint64_t count;
+        if (read(trace_wake_fd, &count, sizeof(count)) == -1 && errno != EINTR) {
+            break;
+        }
+
+        int buffers = trace_buffer_count < TRACE_MAX_THREADS ? trace_buffer_count : TRACE_MAX_THREADS;
+        for (int i = 0; i < buffers; i++) {
+            for (int half = 0; half < 2; half++) {
+                TraceBuffer *buffer = &trace_buffers[i];
+                if (atomic_load_explicit(&buffer->full[half], memory_order_acquire)) {
+                    trace_write_half(buffer, half);
+                    atomic_store_explicit(&buffer->full[half], 0, memory_order_release);
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+// Function to stop the trace thread and write out everything still buffered.
+// Called from cleanup(), after every traced thread has stopped.
+void trace_close(void) {
+    if (trace_file == NULL) {
+        return;
+    }
+
+    trace_running = 0;
+    uint64_t one = 1;
+    if (write(trace_wake_fd, &one, sizeof(one)) == (ssize_t)sizeof(one)) {
+        pthread_join(trace_thread, NULL);
+    }
+
+    int buffers = trace_buffer_count < TRACE_MAX_THREADS ? trace_buffer_count : TRACE_MAX_THREADS;
+    unsigned long dropped = 0;
+    for (int i = 0; i < buffers; i++) {
+        TraceBuffer *buffer = &trace_buffers[i];
+
+        // The half not being appended to is the older one
+        int older = buffer->current ^ 1;
+        if (buffer->full[older]) {
+            trace_write_half(buffer, older);
+        }
+        trace_write_half(buffer, buffer->current);
+        dropped += buffer->dropped;
+
+        fprintf(trace_file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                trace_first_event ? "" : ",\n", (int)getpid(), buffer->tid, buffer->thread_name);
+        trace_first_event = 0;
+    }
+    fputs("\n]}\n", trace_file);
+    fclose(trace_file);
+    trace_file = NULL;
+    close(trace_wake_fd);
+    trace_wake_fd = -1;
+
+    if (dropped > 0) {
+        fprintf(stderr, "trace: %lu events dropped while the trace thread was behind\n", dropped);
+    }
+}
+#endif
+
+#if defined(TERMKEY_BENCH) || defined(TERMKEY_ALLOC_CHECK)
+// Allocator interposer shared by the benchmarks, which count allocations, and
+// by the allocation check, which rejects them inside event-processing scopes.
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void *__libc_valloc(size_t size);
+extern void *__libc_pvalloc(size_t size);
+extern void __libc_free(void *ptr);
+
+static atomic_ulong allocation_count = 0;
+
+// Function to count an allocation and fail if the event path made it after warm-up
+void note_allocation(size_t size) {
+    atomic_fetch_add_explicit(&allocation_count, 1, memory_order_relaxed);
+#ifdef TERMKEY_ALLOC_CHECK
+    const char *scope = alloc_scope;
+    if (scope != NULL && atomic_load_explicit(&alloc_scopes_done, memory_order_relaxed) >= ALLOC_WARMUP_SCOPES) {
+        alloc_scope = NULL; // Reporting must not come back here
+        char message[128];
+        int len = snprintf(message, sizeof(message), "termkey: %zu-byte allocation in %s after warm-up\n", size, scope);
+        ssize_t n = write(STDERR_FILENO, message, (size_t)len);
+        (void)n;
+        abort();
+    }
+#else
+    (void)size;
+#endif
+}
+
+void *malloc(size_t size) {
+    note_allocation(size);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    note_allocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    note_allocation(size);
+    return __libc_realloc(ptr, size);
+}
+
+// The aligned allocators are interposed too, or an allocation through them
+// would slip past the check. glibc has no __libc_ entry for posix_memalign or
+// aligned_alloc; both are memalign with their own argument rules
+void *memalign(size_t alignment, size_t size) {
+    note_allocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    note_allocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size) {
+    if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    note_allocation(size);
+    void *result = __libc_memalign(alignment, size);
+    if (result == NULL) {
+        return ENOMEM;
+    }
+    *ptr = result;
+    return 0;
+}
+
+void *valloc(size_t size) {
+    note_allocation(size);
+    return __libc_valloc(size);
+}
+
+void *pvalloc(size_t size) {
+    note_allocation(size);
+    return __libc_pvalloc(size);
+}
+
+void free(void *ptr) {
+    __libc_free(ptr);
+}
+#endif
+
+#ifdef TERMKEY_BENCH
+// Microbenchmarks of the per-event path, built with -DTERMKEY_BENCH.
+//
+// Synthetic XRecordInterceptData/xEvent payloads are fed to process_intercept()
+// and the render path is run inline after every event, writing frames to
+// /dev/null, so no X server or terminal is involved. Allocations are counted
+// through the allocator interposer above, after an untimed warm-up, and any
+// allocation in the measured events fails the run.
+
+#define BENCH_EVENTS 200000
+#define BENCH_WARMUP_EVENTS 1000
+#define LATENCY_BENCH_RATE     1000       // Injected presses per second in the measurement run
+#define LATENCY_RAMP_EVENTS    1000       // Presses per step of the throughput ramp
+#define LATENCY_RAMP_STEPS     8          // Ramp starts at 500/s and doubles each step
+#define LATENCY_BACKLOG_NS     10000000ULL // A step whose p99 exceeds 10 ms has built a backlog
+#define LATENCY_DRAIN_TIMEOUT  2000       // Milliseconds to wait for the last frames of a run
+
+// One synthetic input event
+typedef struct {
+    uint8_t type;
+    uint8_t detail;
+} BenchEvent;
+
+// A named sequence of events that is replayed in a loop
+typedef struct BenchScenario {
+    const char *name;
+    const BenchEvent *events;
+    size_t count;
+    unsigned int time_step;           // Server milliseconds between events
+    unsigned int repeat_window;       // Aggregation window for this scenario
+} BenchScenario;
+
+// Keycodes of a typical evdev keymap, resolved through fill_key_label()
+#define BENCH_KEY_A       38
+#define BENCH_KEY_CTRL_L  37
+#define BENCH_KEY_SHIFT_L 50
+#define BENCH_KEY_ALT_L   64
+#define BENCH_KEY_SUPER_L 133
+
+static const BenchEvent bench_lone_modifier[] = {
+    {KeyPress, BENCH_KEY_SHIFT_L}, {KeyRelease, BENCH_KEY_SHIFT_L}
+};
+
+static const BenchEvent bench_four_modifiers[] = {
+    {KeyPress, BENCH_KEY_CTRL_L}, {KeyPress, BENCH_KEY_ALT_L},
+    {KeyPress, BENCH_KEY_SHIFT_L}, {KeyPress, BENCH_KEY_SUPER_L},
+    {KeyPress, BENCH_KEY_A}, {KeyRelease, BENCH_KEY_A},
+    {KeyRelease, BENCH_KEY_SUPER_L}, {KeyRelease, BENCH_KEY_SHIFT_L},
+    {KeyRelease, BENCH_KEY_ALT_L}, {KeyRelease, BENCH_KEY_CTRL_L}
+};
+
+static const BenchEvent bench_wheel_burst[] = {
+    {ButtonPress, Button5}, {ButtonRelease, Button5}
+};
+
+#define BENCH_EVENTS_IN(events) (sizeof(events) / sizeof(BenchEvent))
+
+static const BenchScenario bench_scenarios[] = {
+    {"lone modifier",       bench_lone_modifier,  BENCH_EVENTS_IN(bench_lone_modifier),  120, 0},
+    {"four-modifier combo", bench_four_modifiers, BENCH_EVENTS_IN(bench_four_modifiers), 40,  0},
+    {"wheel burst",         bench_wheel_burst,    BENCH_EVENTS_IN(bench_wheel_burst),    8,   700}
+};
+
+// Function to run one scenario, print its line of results and return its allocations
+unsigned long run_benchmark_scenario(const BenchScenario *scenario, int colour) {
+    xEvent event;
+    XRecordInterceptData data;
+    memset(&data, 0, sizeof(data));
+    data.category = XRecordFromServer;
+    data.data = (unsigned char *)&event;
+    data.data_len = sizeof(xEvent) / 4;
+
+    use_color = colour;
+    repeat_window = scenario->repeat_window;
+    sources[0].modifiers = 0;
+    sources[0].mouse_button_pressed = 0;
+    screen_dirty = 1;
+    last_repeat_key = 0;
+
+    unsigned long bytes_before = 0;
+    unsigned long allocations_before = 0;
+    struct timespec start, end;
+
+    for (size_t i = 0; i < BENCH_WARMUP_EVENTS + BENCH_EVENTS; i++) {
+        if (i == BENCH_WARMUP_EVENTS) {
+            bytes_before = frame_bytes_total;
+            allocations_before = allocation_count;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+        }
+
+        const BenchEvent *bench_event = &scenario->events[i % scenario->count];
+        memset(&event, 0, sizeof(event));
+        event.u.u.type = bench_event->type;
+        event.u.u.detail = bench_event->detail;
+        data.server_time += scenario->time_step;
+
+        ALLOC_SCOPE_BEGIN("bench");
+        process_intercept(&sources[0], &data);
+        collect_pending_records();
+        flush_pending_frame();
+        ALLOC_SCOPE_END();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ns = (double)(end.tv_sec - start.tv_sec) * 1e9 + (double)(end.tv_nsec - start.tv_nsec);
+    unsigned long allocations = allocation_count - allocations_before;
+
+    printf("%-22s %-6s %10.1f %12.1f %13.3f\n", scenario->name, colour ? "on" : "off",
+           ns / BENCH_EVENTS,
+           (double)(frame_bytes_total - bytes_before) / BENCH_EVENTS,
+           (double)allocations / BENCH_EVENTS);
+    return allocations;
+}
+
+// Function to run every scenario with and without colour
+int run_benchmarks(void) {
+    output_fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    if (output_fd == -1) {
+        perror("/dev/null");
+        return -1;
+    }
+
+    // Label the keycodes the scenarios use without asking an X server
+    KeyLabel *table = sources[0].key_labels;
+    fill_key_label(&table[BENCH_KEY_A], XK_a);
+    fill_key_label(&table[BENCH_KEY_CTRL_L], XK_Control_L);
+    fill_key_label(&table[BENCH_KEY_SHIFT_L], XK_Shift_L);
+    fill_key_label(&table[BENCH_KEY_ALT_L], XK_Alt_L);
+    fill_key_label(&table[BENCH_KEY_SUPER_L], XK_Super_L);
+
+    strcpy(bg_color_name, "red");
+    strcpy(fg_color_name, "blue");
+    strcpy(letter_color_name, "yellow");
+    compile_color_phases();
+
+    printf("%-22s %-6s %10s %12s %13s\n", "scenario", "colour", "ns/event", "bytes/event", "allocs/event");
+    unsigned long allocations = 0;
+    for (size_t i = 0; i < sizeof(bench_scenarios) / sizeof(bench_scenarios[0]); i++) {
+        allocations += run_benchmark_scenario(&bench_scenarios[i], 0);
+        allocations += run_benchmark_scenario(&bench_scenarios[i], 1);
+    }
+
+    close(output_fd);
+    output_fd = STDOUT_FILENO;
+
+    // The event path must not allocate once warm; treat any allocation as a regression
+    if (allocations > 0) {
+        fprintf(stderr, "%lu allocations in the event path after warm-up.\n", allocations);
+        return -1;
+    }
+    return 0;
+}
+
+// End-to-end latency benchmark (--latency-bench N), meant to run under Xvfb.
+//
+// A separate thread injects key presses with XTest on its own connection,
+// cycling through the letter keys so that the keycode of a press tells its
+// injection index modulo LATENCY_KEYS. The capture thread matches each press
+// to the next injection with that residue (latency_bench_seen) and tags its
+// record with the index, so a lost or stray event only affects its own
+// sample. The render thread stamps every tagged press that went into a frame
+// once that frame's write() returns (latency_bench_written).
+#define LATENCY_KEYS           26         // Letter keys the injector cycles through
+#define LATENCY_TAG            0x8000     // Set in EventRecord.reserved of a matched press
+#define LATENCY_PENDING_MAX    4096       // Tagged presses collected for one frame
+
+static size_t latency_total = 0;             // Slots in the timestamp arrays, ramp included
+static KeyCode latency_keycodes[LATENCY_KEYS]; // Keys being injected, press i uses i % LATENCY_KEYS
+static uint8_t latency_key_residue[MAX_KEYCODES]; // Position of a keycode in latency_keycodes, or 0xff
+static uint64_t *latency_inject = NULL;      // Monotonic ns when each press was injected, 0 if it was not
+static uint64_t *latency_seen = NULL;        // ... when the capture thread decoded it, 0 if it never arrived
+static uint64_t *latency_written = NULL;     // ... when the frame showing it was written, 0 if none did
+static uint64_t *latency_sorted = NULL;      // Injector thread: one stage's latencies, sorted for the report
+static atomic_size_t latency_injected = 0;   // Presses sent so far; a match beyond this is not ours
+static atomic_size_t latency_seen_high = 0;  // One past the last index matched by the capture thread
+static atomic_size_t latency_written_high = 0; // One past the last index the render thread has settled
+static size_t latency_next_match = 0;        // Capture thread: smallest index the next press can be
+static size_t latency_collected_last = 0;    // Render thread: index of the last tagged press collected
+static size_t latency_pending[LATENCY_PENDING_MAX]; // Render thread: indices waiting for the next write
+static size_t latency_pending_count = 0;
+static pthread_t latency_thread;
+
+// Function to compare two latencies for qsort
+int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Capture thread: match an injected press to its index, stamp it and tag its record
+void latency_bench_seen(EventRecord *record) {
+    if (latency_bench_events == 0 || record->type != KeyPress || latency_key_residue[record->detail] == 0xff) {
+        return;
+    }
+
+    // Events arrive in injection order, so a press is the first injection past
+    // the previous match with its residue; up to LATENCY_KEYS - 1 lost presses
+    // in a row are skipped over. One that was never injected is a stray
+    size_t residue = latency_key_residue[record->detail];
+    size_t i = latency_next_match + (residue + LATENCY_KEYS - latency_next_match % LATENCY_KEYS) % LATENCY_KEYS;
+    if (i >= atomic_load_explicit(&latency_injected, memory_order_acquire)) {
+        return;
+    }
+    latency_seen[i] = monotonic_ns();
+    latency_next_match = i + 1;
+    atomic_store_explicit(&latency_seen_high, i + 1, memory_order_release);
+
+    uint16_t tag = (uint16_t)(LATENCY_TAG | (i & (LATENCY_TAG - 1)));
+    memcpy(record->reserved, &tag, sizeof(tag));
+}
+
+// Render thread: remember a tagged press taken off the ring until its frame is written
+void latency_bench_collected(const EventRecord *record) {
+    uint16_t tag;
+    memcpy(&tag, record->reserved, sizeof(tag));
+    if (latency_bench_events == 0 || !(tag & LATENCY_TAG)) {
+        return;
+    }
+
+    // The tag holds the low 15 bits; presses come off the ring in order
+    size_t low = tag & (LATENCY_TAG - 1);
+    size_t i = latency_collected_last + ((low - latency_collected_last) & (LATENCY_TAG - 1));
+    latency_collected_last = i;
+    if (i < latency_total && latency_pending_count < LATENCY_PENDING_MAX) {
+        latency_pending[latency_pending_count++] = i;
+    }
+}
+
+// Render thread: every press collected so far is on screen once write() returns
+void latency_bench_written(void) {
+    if (latency_bench_events == 0 || latency_pending_count == 0) {
+        return;
+    }
+    uint64_t now = monotonic_ns();
+    for (size_t i = 0; i < latency_pending_count; i++) {
+        latency_written[latency_pending[i]] = now;
+    }
+
+    // Presses before the last one written that are still unstamped were lost on the way
+    size_t high = latency_pending[latency_pending_count - 1] + 1;
+    latency_pending_count = 0;
+    atomic_store_explicit(&latency_written_high, high, memory_order_release);
+}
+
+// Function to inject count presses starting at slot first, paced at rate per second
+void latency_inject_run(Display *dpy, size_t first, size_t count, unsigned int rate) {
+    uint64_t interval = 1000000000ULL / rate;
+    uint64_t next = monotonic_ns();
+
+    for (size_t i = first; i < first + count; i++) {
+        struct timespec due = {(time_t)(next / 1000000000ULL), (long)(next % 1000000000ULL)};
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL);
+
+        KeyCode keycode = latency_keycodes[i % LATENCY_KEYS];
+        latency_inject[i] = monotonic_ns();
+        atomic_store_explicit(&latency_injected, i + 1, memory_order_release);
+        XTestFakeKeyEvent(dpy, keycode, True, CurrentTime);
+        XTestFakeKeyEvent(dpy, keycode, False, CurrentTime);
+        XFlush(dpy);
+        next += interval;
+    }
+
+    // Give the pipeline a moment to draw the last presses
+    for (int waited = 0; waited < LATENCY_DRAIN_TIMEOUT; waited++) {
+        if (atomic_load_explicit(&latency_written_high, memory_order_acquire) >= first + count) {
+            break;
+        }
+        usleep(1000);
+    }
+}
+
+// Function to sort the latencies of slots [first, first + count) into out; returns how many completed.
+// Slots from ended on may still be written to, and a 0 below it is a press that was lost
+size_t latency_collect(size_t first, size_t count, const uint64_t *end_times, size_t ended, uint64_t *out) {
+    size_t n = 0;
+    for (size_t i = first; i < first + count && i < ended; i++) {
+        if (end_times[i] != 0) {
+            out[n++] = end_times[i] - latency_inject[i];
+        }
+    }
+    qsort(out, n, sizeof(*out), compare_u64);
+    return n;
+}
+
+// Function to print p50/p99/p999 of a sorted latency array
+void latency_report(const char *stage, const uint64_t *sorted, size_t n, size_t expected) {
+    if (n == 0) {
+        fprintf(stderr, "%-18s no events arrived\n", stage);
+        return;
+    }
+    fprintf(stderr, "%-18s p50 %8.1f us  p99 %8.1f us  p999 %8.1f us  (%zu/%zu)\n", stage,
+            (double)sorted[n / 2] / 1e3,
+            (double)sorted[(n * 99) / 100] / 1e3,
+            (double)sorted[(n * 999) / 1000] / 1e3, n, expected);
+}
+
+// Injector thread: measurement run, then a throughput ramp, then stop termkey
+void *latency_bench_main(void *arg) {
+    (void)arg;
+
+    Display *dpy = XOpenDisplay(sources[0].name);
+    int event_base, error_base, major, minor;
+    if (dpy == NULL || !XTestQueryExtension(dpy, &event_base, &error_base, &major, &minor)) {
+        fprintf(stderr, "XTest extension not available.\n");
+        if (dpy != NULL) {
+            XCloseDisplay(dpy);
+        }
+        kill(getpid(), SIGTERM);
+        return NULL;
+    }
+
+    uint64_t *sorted = latency_sorted;
+
+    // Latency distribution at a steady rate
+    size_t n = latency_bench_events;
+    latency_inject_run(dpy, 0, n, LATENCY_BENCH_RATE);
+    fprintf(stderr, "\nLatency over %zu presses at %d/s:\n", n, LATENCY_BENCH_RATE);
+    size_t seen = atomic_load(&latency_seen_high), written = atomic_load(&latency_written_high);
+    latency_report("inject -> callback", sorted, latency_collect(0, n, latency_seen, seen, sorted), n);
+    latency_report("inject -> write", sorted, latency_collect(0, n, latency_written, written, sorted), n);
+
+    // Throughput ramp: the highest rate whose p99 stays under the backlog threshold
+    unsigned int sustained = 0;
+    unsigned int rate = 500;
+    size_t first = n;
+    for (int step = 0; step < LATENCY_RAMP_STEPS; step++, rate *= 2, first += LATENCY_RAMP_EVENTS) {
+        latency_inject_run(dpy, first, LATENCY_RAMP_EVENTS, rate);
+        written = atomic_load(&latency_written_high);
+        size_t done = latency_collect(first, LATENCY_RAMP_EVENTS, latency_written, written, sorted);
+        if (done < LATENCY_RAMP_EVENTS || sorted[(done * 99) / 100] > LATENCY_BACKLOG_NS) {
+            break;
+        }
+        sustained = rate;
+    }
+    fprintf(stderr, "Sustained rate before backlog: %u events/s\n", sustained);
+
+    XCloseDisplay(dpy);
+    kill(getpid(), SIGTERM);
+    return NULL;
+}
+
+// Function to allocate the timestamp arrays and start the injector thread
+int start_latency_bench(size_t events) {
+    memset(latency_key_residue, 0xff, sizeof(latency_key_residue));
+    for (int i = 0; i < LATENCY_KEYS; i++) {
+        latency_keycodes[i] = XKeysymToKeycode(sources[0].display, XK_a + i);
+        if (latency_keycodes[i] == 0 || latency_key_residue[latency_keycodes[i]] != 0xff) {
+            fprintf(stderr, "The current keymap has no distinct keycode for every letter.\n");
+            return -1;
+        }
+        latency_key_residue[latency_keycodes[i]] = (uint8_t)i;
     }
-    if (record_display) {
-        XCloseDisplay(record_display);
-        record_display = NULL;
+
+    latency_total = events + (size_t)LATENCY_RAMP_EVENTS * LATENCY_RAMP_STEPS;
+    latency_inject = calloc(latency_total, sizeof(uint64_t));
+    latency_seen = calloc(latency_total, sizeof(uint64_t));
+    latency_written = calloc(latency_total, sizeof(uint64_t));
+    latency_sorted = malloc(latency_total * sizeof(uint64_t));
+    if (latency_inject == NULL || latency_seen == NULL || latency_written == NULL || latency_sorted == NULL) {
+        fprintf(stderr, "Out of memory.\n");
+        return -1;
+    }
+
+    if (pthread_create(&latency_thread, NULL, latency_bench_main, NULL) != 0) {
+        fprintf(stderr, "Error starting injector thread.\n");
+        return -1;
     }
+    pthread_detach(latency_thread);
+    return 0;
 }
+#endif
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# gen_keysym_names.py
+#
+# Generates keysym_names.h: every keysym name from the X11 keysym headers,
+# uppercased, in one contiguous string pool, indexed through a minimal perfect
+# hash so termkey can name a keysym without Xlib's keysym database.
+#
+# Usage: tools/gen_keysym_names.py [/usr/include/X11] > keysym_names.h
+
+import re
+import sys
+
+# Headers in the order libX11's makekeys reads them; for a keysym with several
+# names the first one wins, as it does for XKeysymToString()
+HEADERS = [
+    ("keysymdef.h", ""),
+    ("XF86keysym.h", ""),
+    ("Sunkeysym.h", ""),
+    ("DECkeysym.h", ""),
+    ("HPkeysym.h", ""),
+]
+
+# Macro prefix -> prefix of the keysym name, e.g. XF86XK_Mail -> XF86Mail
+PREFIXES = [("XF86XK_", "XF86"), ("SunXK_", "Sun"), ("DXK_", "D"),
+            ("hpXK_", "hp"), ("osfXK_", "osf"), ("XK_", "")]
+
+DEFINE = re.compile(r"^#define\s+(\w+)\s+(0x[0-9a-fA-F]+|_EVDEVK\((0x[0-9a-fA-F]+)\))")
+
+MASK = 0xFFFFFFFF
+
+
+def keysym_hash(keysym, seed):
+    # Must match keysym_hash() in termkey.c
+    k = (keysym ^ seed) & MASK
+    k = (k * 0x9E3779B1) & MASK
+    k ^= k >> 16
+    k = (k * 0x85EBCA6B) & MASK
+    k ^= k >> 13
+    return k
+
+
+def read_keysyms(include_dir):
+    names = {}
+    for header, _ in HEADERS:
+        try:
+            lines = open(f"{include_dir}/{header}", encoding="latin-1").read().splitlines()
+        except FileNotFoundError:
+            continue
+        for line in lines:
+            m = DEFINE.match(line)
+            if not m:
+                continue
+            macro = m.group(1)
+            for macro_prefix, name_prefix in PREFIXES:
+                if macro.startswith(macro_prefix):
+                    name = name_prefix + macro[len(macro_prefix):]
+                    break
+            else:
+                continue
+            value = 0x10081000 + int(m.group(3), 16) if m.group(3) else int(m.group(2), 16)
+            if value not in names and value != 0:
+                names[value] = name.upper()
+    return names
+
+
+def build_hash(keysyms):
+    # Hash and displace: bucket keys by one hash, then give each bucket, largest
+    # first, the smallest seed that sends all its keys to free slots
+    n = len(keysyms)
+    bucket_count = max(1, n // 4)
+    buckets = [[] for _ in range(bucket_count)]
+    for k in keysyms:
+        buckets[keysym_hash(k, 0) % bucket_count].append(k)
+
+    slots = [None] * n
+    seeds = [0] * bucket_count
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        keys = buckets[b]
+        if not keys:
+            continue
+        seed = 1
+        while True:
+            positions = [keysym_hash(k, seed) % n for k in keys]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+            seed += 1
+        seeds[b] = seed
+        for k, p in zip(keys, positions):
+            slots[p] = k
+    return seeds, slots
+
+
+def main():
+    include_dir = sys.argv[1] if len(sys.argv) > 1 else "/usr/include/X11"
+    names = read_keysyms(include_dir)
+    seeds, slots = build_hash(sorted(names))
+
+    pool = bytearray()
+    entries = []
+    for k in slots:
+        name = names[k].encode("latin-1")
+        entries.append((k, len(pool), len(name)))
+        pool += name
+
+    out = sys.stdout
+    out.write("// keysym_names.h\n")
+    out.write("//\n")
+    out.write("// Generated by tools/gen_keysym_names.py from the X11 keysym headers; do not edit.\n")
+    out.write(f"// {len(entries)} keysyms, {len(pool)} bytes of names.\n\n")
+    out.write("#ifndef KEYSYM_NAMES_H\n#define KEYSYM_NAMES_H\n\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write(f"#define KEYSYM_NAME_COUNT   {len(entries)}\n")
+    out.write(f"#define KEYSYM_BUCKET_COUNT {len(seeds)}\n\n")
+    out.write("typedef struct {\n")
+    out.write("    uint32_t keysym;\n")
+    out.write("    uint32_t name;                    // Offset into keysym_name_pool << 8 | length\n")
+    out.write("} KeysymName;\n\n")
+
+    out.write("static const uint32_t keysym_bucket_seeds[KEYSYM_BUCKET_COUNT] = {\n")
+    for i in range(0, len(seeds), 8):
+        out.write("    " + ", ".join(str(s) for s in seeds[i:i + 8]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("static const KeysymName keysym_names[KEYSYM_NAME_COUNT] = {\n")
+    for i in range(0, len(entries), 4):
+        row = ", ".join(f"{{0x{k:08x}, 0x{(offset << 8) | length:x}}}" for k, offset, length in entries[i:i + 4])
+        out.write(f"    {row},\n")
+    out.write("};\n\n")
+
+    out.write("static const char keysym_name_pool[] =\n")
+    text = pool.decode("latin-1")
+    for i in range(0, len(text), 72):
+        out.write(f'    "{text[i:i + 72]}"\n')
+    out.write("    ;\n\n")
+    out.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()